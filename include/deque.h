@@ -0,0 +1,181 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This is the header for a double-ended queue backed by a ring of
+ *               fixed-size chunks. It offers the push and pop operations of the
+ *               doubly linked list at both ends, plus indexed access, without
+ *               any allocation per element: chunks are allocated once and
+ *               reused, and the ring of chunks doubles when full.
+ *
+ *               Iterators follow the Begin/End/Next/Prev style of dll.h. They
+ *               are positions, so pushing or popping at either end moves the
+ *               elements an iterator refers to.
+ ******************************************************************************/
+#ifndef __DEQUE_H__
+#define __DEQUE_H__
+
+#include <stddef.h>   /* size_t, NULL */
+
+typedef struct deque deque_t;
+
+typedef struct deque_iter
+{
+	const deque_t *deque;
+	size_t index;
+
+} deque_iter_t;
+
+typedef int (*deque_act_func_t) (void *data, void *param);
+
+/******************************************************************************
+ * @brief     Creates a new deque.
+ * @return    Pointer to the created deque, or NULL if creation fails.
+ * Complexity Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+deque_t *DequeCreate(void);
+
+/******************************************************************************
+ * @brief       Destroys a deque and its chunks.
+ * @param deque Pointer to the deque to be destroyed.
+ * Complexity   Time complexity: O(n), Space complexity: O(1).
+******************************************************************************/
+void DequeDestroy(deque_t *deque);
+
+/******************************************************************************
+ * @brief       Pushes data to the back of the deque.
+ * @param deque Pointer to the deque.
+ * @param data  Pointer to the data to be pushed.
+ * @return      0 on success, -1 if push fails.
+ * Complexity   Time complexity: O(1) amortized, Space complexity: O(1).
+******************************************************************************/
+int DequePushBack(deque_t *deque, void *data);
+
+/******************************************************************************
+ * @brief       Pushes data to the front of the deque.
+ * @param deque Pointer to the deque.
+ * @param data  Pointer to the data to be pushed.
+ * @return      0 on success, -1 if push fails.
+ * Complexity   Time complexity: O(1) amortized, Space complexity: O(1).
+******************************************************************************/
+int DequePushFront(deque_t *deque, void *data);
+
+/******************************************************************************
+ * @brief       Pops data from the back of the deque. Undefined if empty.
+ * @param deque Pointer to the deque.
+ * @return      Pointer to the popped data.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+void *DequePopBack(deque_t *deque);
+
+/******************************************************************************
+ * @brief       Pops data from the front of the deque. Undefined if empty.
+ * @param deque Pointer to the deque.
+ * @return      Pointer to the popped data.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+void *DequePopFront(deque_t *deque);
+
+/******************************************************************************
+ * @brief       Gets the data at an index, 0 being the front.
+ * @param deque Pointer to the deque.
+ * @param index Index, lower than DequeCount.
+ * @return      Pointer to the data.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+void *DequeGet(const deque_t *deque, size_t index);
+
+/******************************************************************************
+ * @brief       Sets the data at an index, 0 being the front.
+ * @param deque Pointer to the deque.
+ * @param index Index, lower than DequeCount.
+ * @param data  Pointer to the new data to be set.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+void DequeSet(deque_t *deque, size_t index, void *data);
+
+/******************************************************************************
+ * @brief       Counts the number of elements in the deque.
+ * @param deque Pointer to the deque.
+ * @return      Number of elements.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+size_t DequeCount(const deque_t *deque);
+
+/******************************************************************************
+ * @brief       Checks if the deque is empty.
+ * @param deque Pointer to the deque.
+ * @return      1 if empty, 0 if not.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+int DequeIsEmpty(const deque_t *deque);
+
+/******************************************************************************
+ * @brief       Returns an iterator pointing to the front of the deque.
+ * @param deque Pointer to the deque.
+ * @return      Iterator pointing to the start of the deque.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+deque_iter_t DequeBegin(const deque_t *deque);
+
+/******************************************************************************
+ * @brief       Returns an iterator pointing past the back of the deque.
+ * @param deque Pointer to the deque.
+ * @return      Iterator pointing to the end of the deque.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+deque_iter_t DequeEnd(const deque_t *deque);
+
+/******************************************************************************
+ * @brief          Returns the next iterator.
+ * @param iterator Iterator.
+ * @return         Next iterator.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+deque_iter_t DequeNext(deque_iter_t iterator);
+
+/******************************************************************************
+ * @brief          Returns the previous iterator.
+ * @param iterator Iterator.
+ * @return         Previous iterator.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+deque_iter_t DequePrev(deque_iter_t iterator);
+
+/******************************************************************************
+ * @brief          Gets data from the element pointed by the given iterator.
+ * @param iterator Iterator pointing to an element.
+ * @return         Pointer to the data.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+void *DequeGetData(deque_iter_t iterator);
+
+/******************************************************************************
+ * @brief          Sets data of the element pointed by the given iterator.
+ * @param iterator Iterator pointing to an element.
+ * @param data     Pointer to the new data to be set.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+void DequeSetData(deque_iter_t iterator, void *data);
+
+/******************************************************************************
+ * @brief       Checks if two iterators are equal.
+ * @param iter1 Iterator.
+ * @param iter2 Iterator.
+ * @return      1 if equal, 0 if not.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+int DequeIterIsEqual(deque_iter_t iter1, deque_iter_t iter2);
+
+/******************************************************************************
+ * @brief       Iterates through a range and performs an action on each data,
+ *              a whole chunk at a time.
+ * @param from  Iterator pointing to the start of the range.
+ * @param to    Iterator pointing to the end of the range (not included).
+ * @param act   Action function, given a pointer to the stored data.
+ * @param param Parameter to be passed to the action function.
+ * @return      0 on success, or the status returned by the action function.
+ * Complexity   Time complexity: O(n), Space complexity: O(1).
+******************************************************************************/
+int DequeForEach(deque_iter_t from, deque_iter_t to, deque_act_func_t act, void *param);
+
+#endif /* __DEQUE_H__ */
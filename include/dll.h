@@ -17,6 +17,8 @@ typedef struct dll_node *dll_iter_t;
 
 typedef struct dll dll_t;
 
+typedef struct dll_cursor dll_cursor_t;
+
 typedef int (*dll_act_func_t) (void *data, void * param);
  
 typedef int (*dll_cmp_func_t) (void *data, void *param);
@@ -70,6 +72,18 @@ dll_iter_t DLLRemove(dll_iter_t iteretor);
 ******************************************************************************/
 dll_iter_t DLLPushBack(dll_t *dll, void *data);
 
+/******************************************************************************
+ * @brief       Pushes an array of data to the back of the doubly linked list,
+ *              linking all the new nodes in a single pass.
+ * @param dll   Pointer to the list.
+ * @param data  Array of pointers to the data to be pushed, in order.
+ * @param count Number of elements in data.
+ * @return      Iterator pointing to the first pushed node, or end of the list
+ *              if push fails. On failure no data is pushed.
+ * Complexity   Time complexity: O(count), Space complexity: O(1).
+******************************************************************************/
+dll_iter_t DLLPushBackMany(dll_t *dll, void **data, size_t count);
+
 /******************************************************************************
  * @brief      Pushes data to the front of the doubly linked list.
  * @param dll  Pointer to the list.
@@ -188,6 +202,31 @@ int DLLForEach(dll_iter_t from, const dll_iter_t to, dll_act_func_t act, void *p
 ******************************************************************************/
 void DLLSplice(dll_iter_t dest, dll_iter_t source_from, dll_iter_t source_to);
 
+/******************************************************************************
+ * @brief          Removes a node like DLLRemove, for data that keep the
+ *                 iterator of their node: the data of the next node move into
+ *                 the removed one, and have to be given that iterator.
+ * @param iterator Iterator pointing to the node to be removed.
+ * @return         Data now held by the node of iterator, or NULL if it became
+ *                 the end of the list.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+void *DLLRemoveGetMoved(dll_iter_t iterator);
+
+/******************************************************************************
+ * @brief             Splices like DLLSplice, for data that keep the iterator of
+ *                    their node: the first spliced data move into the node of
+ *                    dest, and the data after the range into the node of
+ *                    source_from, which have to be given that iterator.
+ * @param dest        Iterator pointing to the destination position.
+ * @param source_from Iterator pointing to the start of the source range.
+ * @param source_to   Iterator pointing to the end of the source range (not included).
+ * @return            Data now held by the node of source_from, or NULL if it
+ *                    became the end of a list.
+ * Complexity         Time complexity: O(n), Space complexity: O(1).
+******************************************************************************/
+void *DLLSpliceGetMoved(dll_iter_t dest, dll_iter_t source_from, dll_iter_t source_to);
+
 /*****************************************************************************/
 
 /******************************************************************************
@@ -217,11 +256,70 @@ dll_iter_t DLLFind(const dll_iter_t from, const dll_iter_t too, dll_cmp_func_t c
 int DLLMultiFind(const dll_iter_t from, const dll_iter_t to, dll_cmp_func_t cmp, void *param, dll_t *dest);
 
 /******************************************************************************
- * @brief       Arranges the elements in the list around a pivot value.
- * @param dll   Pointer to the list.
+ * @brief       Arranges the elements in the list around a pivot value: lower
+ *              values first, then equal ones, then greater ones.
+ * @param dll   Pointer to the list, whose data point to int.
  * @param pivot Pointer to the pivot value.
  * Complexity   Time complexity: O(n), Space complexity: O(1).
 ******************************************************************************/
 void DLLArrange(dll_t *dll, void *pivot);
 
+/******************************************************************************
+ * @brief       Creates a cursor performing an action on each data of a range,
+ *              a bounded number of nodes at a time.
+ *
+ *              A cursor follows elements, not nodes: inserts, removes, pushes,
+ *              pops and splices made by the thread that created it, including
+ *              from within the action, keep it valid. Elements inserted before
+ *              its position are not visited, and removing its next element moves it
+ *              to the element after. The range ends at the element to points to
+ *              when created, the element after it if it is removed, or the end
+ *              of the list if it is spliced away. A range ending at the end of
+ *              the list takes in elements pushed to its back. Lists a cursor
+ *              visits must outlive it.
+ * @param from  Iterator pointing to the start of the range.
+ * @param to    Iterator pointing to the end of the range (not included).
+ * @param act   Action function to be performed on each data element.
+ * @param param Parameter to be passed to the action function.
+ * @return      Pointer to the cursor, or NULL if creation fails.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_cursor_t *DLLCursorCreate(dll_iter_t from, dll_iter_t to, dll_act_func_t act, void *param);
+
+/******************************************************************************
+ * @brief        Destroys a cursor, finished or not.
+ * @param cursor Pointer to the cursor to be destroyed.
+ * Complexity    Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+void DLLCursorDestroy(dll_cursor_t *cursor);
+
+/******************************************************************************
+ * @brief        Performs the action of a cursor on at most budget elements,
+ *               resuming where the previous step stopped.
+ * @param cursor Pointer to the cursor.
+ * @param budget Maximum number of elements to visit.
+ * @return       0 on success, or the status returned by the action function.
+ *               The element returning it counts as visited, so the next step
+ *               resumes after it.
+ * Complexity    Time complexity: O(budget), Space complexity: O(1).
+******************************************************************************/
+int DLLCursorStep(dll_cursor_t *cursor, size_t budget);
+
+/******************************************************************************
+ * @brief        Checks if a cursor visited its whole range.
+ * @param cursor Pointer to the cursor.
+ * @return       1 if done, 0 if not.
+ * Complexity    Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+int DLLCursorIsDone(const dll_cursor_t *cursor);
+
+/******************************************************************************
+ * @brief        Returns the iterator of the element the action of a cursor is
+ *               performed on, so the action may remove or insert around it.
+ * @param cursor Pointer to the cursor, within its action.
+ * @return       Iterator of the visited element, valid until the list changes.
+ * Complexity    Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_iter_t DLLCursorCurrent(const dll_cursor_t *cursor);
+
 #endif /* __DLL_H__ */
@@ -0,0 +1,153 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This is the header for a bounded channel passing data from
+ *               producers to consumers in FIFO order through a doubly linked
+ *               list. Senders block while the channel is full and receivers
+ *               while it is empty, sleeping instead of polling the list.
+ *
+ *               Each direction has a file descriptor, readable while it is
+ *               possible to receive, or to send, without blocking. They can
+ *               be waited on with poll or epoll, e.g. by an event loop or a
+ *               coroutine scheduler using the Try functions, which never
+ *               block. A descriptor only changes when the channel turns empty,
+ *               full or closed, so a burst of data costs a single wakeup.
+ *
+ *               Several threads may send and receive at once. Closing wakes
+ *               them all: sending fails from then on, and receiving goes on
+ *               until the channel is empty.
+ ******************************************************************************/
+#ifndef __DLL_CHANNEL_H__
+#define __DLL_CHANNEL_H__
+
+#include <stddef.h>   /* size_t, NULL */
+
+typedef struct dll_channel dll_channel_t;
+
+typedef enum dll_channel_status
+{
+	DLL_CHANNEL_SUCCESS,
+	/* Full on sending, or empty on receiving */
+	DLL_CHANNEL_WOULD_BLOCK,
+	/* Closed on sending, or closed and empty on receiving */
+	DLL_CHANNEL_CLOSED,
+	DLL_CHANNEL_FAILURE
+
+} dll_channel_status_t;
+
+/******************************************************************************
+ * @brief          Creates a new channel.
+ * @param capacity Maximum number of data in the channel, at least 1.
+ * @return         Pointer to the created channel, or NULL if creation fails.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_channel_t *DLLChannelCreate(size_t capacity);
+
+/******************************************************************************
+ * @brief         Destroys a channel and its descriptors. No thread may use the
+ *                channel any more, and the data left in it are not freed.
+ * @param channel Pointer to the channel to be destroyed.
+ * Complexity     Time complexity: O(n), Space complexity: O(1).
+******************************************************************************/
+void DLLChannelDestroy(dll_channel_t *channel);
+
+/******************************************************************************
+ * @brief         Sends data if the channel is not full, without blocking.
+ * @param channel Pointer to the channel.
+ * @param data    Pointer to the data to be sent.
+ * @return        DLL_CHANNEL_SUCCESS, DLL_CHANNEL_WOULD_BLOCK if full,
+ *                DLL_CHANNEL_CLOSED, or DLL_CHANNEL_FAILURE.
+ * Complexity     Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_channel_status_t DLLChannelTrySend(dll_channel_t *channel, void *data);
+
+/******************************************************************************
+ * @brief         Sends data, waiting while the channel is full.
+ * @param channel Pointer to the channel.
+ * @param data    Pointer to the data to be sent.
+ * @return        DLL_CHANNEL_SUCCESS, DLL_CHANNEL_CLOSED, or
+ *                DLL_CHANNEL_FAILURE.
+ * Complexity     Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_channel_status_t DLLChannelSend(dll_channel_t *channel, void *data);
+
+/******************************************************************************
+ * @brief         Sends an array of data in order, as many at a time as there
+ *                is room for, waiting while the channel is full.
+ * @param channel Pointer to the channel.
+ * @param data    Array of pointers to the data to be sent.
+ * @param count   Number of elements in data.
+ * @return        Number of data sent, lower than count only if the channel is
+ *                closed or on failure.
+ * Complexity     Time complexity: O(count), Space complexity: O(1).
+******************************************************************************/
+size_t DLLChannelSendMany(dll_channel_t *channel, void **data, size_t count);
+
+/******************************************************************************
+ * @brief         Receives the oldest data if the channel is not empty,
+ *                without blocking.
+ * @param channel Pointer to the channel.
+ * @param data    Set to the received data.
+ * @return        DLL_CHANNEL_SUCCESS, DLL_CHANNEL_WOULD_BLOCK if empty, or
+ *                DLL_CHANNEL_CLOSED if closed and empty.
+ * Complexity     Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_channel_status_t DLLChannelTryReceive(dll_channel_t *channel, void **data);
+
+/******************************************************************************
+ * @brief         Receives the oldest data, waiting while the channel is empty.
+ * @param channel Pointer to the channel.
+ * @param data    Set to the received data.
+ * @return        DLL_CHANNEL_SUCCESS, or DLL_CHANNEL_CLOSED if closed and
+ *                empty.
+ * Complexity     Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_channel_status_t DLLChannelReceive(dll_channel_t *channel, void **data);
+
+/******************************************************************************
+ * @brief         Receives the oldest data, as many as there are up to max,
+ *                waiting while the channel is empty.
+ * @param channel Pointer to the channel.
+ * @param data    Array set to the received data, in order.
+ * @param max     Number of elements in data, at least 1.
+ * @return        Number of data received, 0 only if closed and empty.
+ * Complexity     Time complexity: O(max), Space complexity: O(1).
+******************************************************************************/
+size_t DLLChannelReceiveMany(dll_channel_t *channel, void **data, size_t max);
+
+/******************************************************************************
+ * @brief         Closes a channel and wakes every thread waiting on it.
+ * @param channel Pointer to the channel.
+ * Complexity     Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+void DLLChannelClose(dll_channel_t *channel);
+
+/******************************************************************************
+ * @brief         Counts the number of data in the channel.
+ * @param channel Pointer to the channel.
+ * @return        Number of data, which other threads may change right away.
+ * Complexity     Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+size_t DLLChannelCount(dll_channel_t *channel);
+
+/******************************************************************************
+ * @brief         Returns the descriptor readable while receiving would not
+ *                block: the channel is not empty, or it is closed. It belongs
+ *                to the channel, and must only be polled, never read.
+ * @param channel Pointer to the channel.
+ * @return        File descriptor.
+ * Complexity     Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+int DLLChannelReceiveFd(const dll_channel_t *channel);
+
+/******************************************************************************
+ * @brief         Returns the descriptor readable while sending would not
+ *                block: the channel is not full, or it is closed. It belongs
+ *                to the channel, and must only be polled, never read.
+ * @param channel Pointer to the channel.
+ * @return        File descriptor.
+ * Complexity     Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+int DLLChannelSendFd(const dll_channel_t *channel);
+
+#endif /* __DLL_CHANNEL_H__ */
@@ -0,0 +1,34 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: Compiler support shared by the list and the modules built on
+ *               it, defined once: functions inlined from headers, and
+ *               variables of which every thread has its own copy.
+ ******************************************************************************/
+#ifndef __DLL_COMPILER_H__
+#define __DLL_COMPILER_H__
+
+/* Headers define their functions with it, the project being built as C89 */
+#ifndef DLL_INLINE
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#define DLL_INLINE static inline
+#elif defined(__GNUC__)
+#define DLL_INLINE static __inline__
+#else
+#define DLL_INLINE static
+#endif
+#endif /* DLL_INLINE */
+
+/* The initial-exec model reads the variable at a fixed offset from the thread
+ * pointer, even in libdll.so, instead of calling __tls_get_addr every time */
+#ifndef DLL_THREAD_LOCAL
+#if defined(__GNUC__)
+#define DLL_THREAD_LOCAL __thread __attribute__((tls_model("initial-exec")))
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define DLL_THREAD_LOCAL _Thread_local
+#else
+#define DLL_THREAD_LOCAL
+#endif
+#endif /* DLL_THREAD_LOCAL */
+
+#endif /* __DLL_COMPILER_H__ */
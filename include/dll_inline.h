@@ -0,0 +1,123 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: Opt-in header that exposes the node layout of the doubly linked
+ *               list and offers static inline versions of the iterator
+ *               operations declared in dll.h. Including it lets tight loops
+ *               compile a step of iteration down to a single load instead of
+ *               an out-of-line call into dll.c.
+ *
+ *               The layout below is the one used by dll.c itself, so inline
+ *               and out-of-line calls may be freely mixed on the same list.
+ *               Code that includes this header must be rebuilt whenever the
+ *               layout changes.
+ ******************************************************************************/
+#ifndef __DLL_INLINE_H__
+#define __DLL_INLINE_H__
+
+#include <assert.h>   /* assert       */
+
+#include "dll.h"          /* dll_iter_t */
+#include "dll_compiler.h" /* DLL_INLINE */
+
+typedef struct dll_node
+{
+	void *data;
+	struct dll_node *next;
+	struct dll_node *prev;
+
+} dll_node_t;
+
+struct dll
+{
+	dll_node_t *head;
+	dll_node_t *tail;
+};
+
+/******************************************************************************
+ * @brief     Inline version of DLLBegin.
+ * @param dll Pointer to the list.
+ * @return    Iterator pointing to the start of the list.
+ * Complexity Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+DLL_INLINE dll_iter_t DLLInlineBegin(const dll_t *dll)
+{
+	assert(dll && "dll isn't valid.");
+	return (dll->head);
+}
+
+/******************************************************************************
+ * @brief     Inline version of DLLEnd.
+ * @param dll Pointer to the list.
+ * @return    Iterator pointing to the end of the list.
+ * Complexity Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+DLL_INLINE dll_iter_t DLLInlineEnd(const dll_t *dll)
+{
+	assert(dll && "dll isn't valid.");
+	return (dll->tail);
+}
+
+/******************************************************************************
+ * @brief          Inline version of DLLNext.
+ * @param iterator Iterator.
+ * @return         Next iterator.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+DLL_INLINE dll_iter_t DLLInlineNext(const dll_iter_t iterator)
+{
+	assert(iterator && "Iterator isn't valid.");
+	return (iterator->next);
+}
+
+/******************************************************************************
+ * @brief          Inline version of DLLPrev.
+ * @param iterator Iterator.
+ * @return         Previous iterator.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+DLL_INLINE dll_iter_t DLLInlinePrev(const dll_iter_t iterator)
+{
+	assert(iterator && "Iterator isn't valid.");
+	return (iterator->prev);
+}
+
+/******************************************************************************
+ * @brief          Inline version of DLLGetData.
+ * @param iterator Iterator pointing to the node.
+ * @return         Pointer to the data in the node.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+DLL_INLINE void *DLLInlineGetData(const dll_iter_t iterator)
+{
+	assert(iterator && "Iterator isn't valid.");
+	return (iterator->data);
+}
+
+/******************************************************************************
+ * @brief          Inline version of DLLSetData.
+ * @param iterator Iterator pointing to the node.
+ * @param data     Pointer to the new data to be set.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+DLL_INLINE void DLLInlineSetData(dll_iter_t iterator, void *data)
+{
+	assert(iterator && "Iterator isn't valid.");
+	iterator->data = data;
+}
+
+/******************************************************************************
+ * @brief       Inline version of DLLIterIsEqual.
+ * @param iter1 Iterator.
+ * @param iter2 Iterator.
+ * @return      1 if equal, 0 if not.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+DLL_INLINE int DLLInlineIterIsEqual(const dll_iter_t iter1, const dll_iter_t iter2)
+{
+	assert(iter1 && "First iterator isn't valid.");
+	assert(iter2 && "Second iterator isn't valid.");
+	return (iter1 == iter2);
+}
+
+#endif /* __DLL_INLINE_H__ */
@@ -0,0 +1,70 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: Streaming bulk loader that builds a doubly linked list from the
+ *               records of a file descriptor. Regular files are memory-mapped,
+ *               other descriptors (pipes, sockets) are read in large chunks.
+ *               The data of every node points directly into that buffer, so
+ *               no record is ever copied, and nodes are linked in batches
+ *               through DLLPushBackMany.
+ *
+ *               The buffer belongs to the loader: the list and the buffer live
+ *               together until DLLLoadDestroy. The buffer is read-only, records
+ *               are not terminated, their size is given by DLLLoadRecordSize.
+ ******************************************************************************/
+#ifndef __DLL_LOAD_H__
+#define __DLL_LOAD_H__
+
+#include <stddef.h>   /* size_t, NULL */
+
+#include "dll.h"      /* dll_t        */
+
+typedef struct dll_load dll_load_t;
+
+typedef enum dll_load_format
+{
+	/* Records separated by '\n', the last one may be unterminated */
+	DLL_LOAD_LINES,
+	/* Every record is preceded by its size as a little endian 32 bit integer */
+	DLL_LOAD_LENGTH_PREFIXED
+
+} dll_load_format_t;
+
+/******************************************************************************
+ * @brief        Loads every record of a file descriptor into a new list.
+ * @param fd     File descriptor, read until end of file. It is not closed.
+ * @param format Format of the records.
+ * @return       Pointer to the loader, or NULL if the input is malformed or
+ *               on failure.
+ * Complexity    Time complexity: O(n), Space complexity: O(n).
+******************************************************************************/
+dll_load_t *DLLLoadFd(int fd, dll_load_format_t format);
+
+/******************************************************************************
+ * @brief      Destroys a loader, its list and its buffer.
+ * @param load Pointer to the loader.
+ * Complexity  Time complexity: O(n), Space complexity: O(1).
+******************************************************************************/
+void DLLLoadDestroy(dll_load_t *load);
+
+/******************************************************************************
+ * @brief      Returns the list built by a loader. Each data is a pointer to a
+ *             record. The list may be modified, but must not be destroyed and
+ *             is valid only until DLLLoadDestroy.
+ * @param load Pointer to the loader.
+ * @return     Pointer to the list.
+ * Complexity  Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_t *DLLLoadList(const dll_load_t *load);
+
+/******************************************************************************
+ * @brief        Returns the size of a record loaded by a loader.
+ * @param load   Pointer to the loader.
+ * @param record Data of a node of the loader's list.
+ * @return       Size of the record in bytes, without separator or prefix.
+ * Complexity    Time complexity: O(1) for length-prefixed records, O(size)
+ *               for lines. Space complexity: O(1).
+******************************************************************************/
+size_t DLLLoadRecordSize(const dll_load_t *load, const void *record);
+
+#endif /* __DLL_LOAD_H__ */
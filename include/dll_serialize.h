@@ -0,0 +1,156 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: Binary serialization of the doubly linked list and read-only,
+ *               memory-mapped snapshots of serialized lists. Payloads are
+ *               encoded and decoded by user callbacks, the file format itself
+ *               is compact, versioned and checksummed (Adler-32).
+ *
+ *               A snapshot maps the file and iterates it in place: every
+ *               record holds the distance to its neighbours, so walking a
+ *               snapshot needs no per-node allocation and no parsing ahead of
+ *               time. As in dll.h, the end of a snapshot is a dummy record.
+ *
+ *               File layout, all integers little endian:
+ *               header : "DLLS" | u32 version | u64 count | u64 end offset |
+ *                        u32 checksum of everything after the header | u32 0
+ *               record : u64 next distance | u64 prev distance | u64 size |
+ *                        payload padded to 8 bytes
+ ******************************************************************************/
+#ifndef __DLL_SERIALIZE_H__
+#define __DLL_SERIALIZE_H__
+
+#include <stddef.h>   /* size_t, NULL */
+
+#include "dll.h"      /* dll_t        */
+
+#define DLL_SERIALIZE_VERSION (1)
+
+typedef struct dll_snapshot dll_snapshot_t;
+
+typedef const struct dll_snap_record *dll_snap_iter_t;
+
+/******************************************************************************
+ * @brief          Encodes one payload into a buffer.
+ * @param data     Data stored in the list.
+ * @param buffer   Buffer to encode into.
+ * @param capacity Size of the buffer in bytes.
+ * @param param    User parameter.
+ * @return         Size of the encoded payload. If it is greater than capacity
+ *                 nothing needs to be written and the call is repeated with a
+ *                 buffer large enough. (size_t)-1 aborts the serialization.
+******************************************************************************/
+typedef size_t (*dll_encode_func_t) (void *data, void *buffer, size_t capacity, void *param);
+
+/******************************************************************************
+ * @brief        Decodes one payload.
+ * @param buffer Encoded payload, valid only during the call.
+ * @param size   Size of the encoded payload in bytes.
+ * @param data   Output, data to store in the list.
+ * @param param  User parameter.
+ * @return       0 on success, non-zero aborts the deserialization.
+******************************************************************************/
+typedef int (*dll_decode_func_t) (const void *buffer, size_t size, void **data, void *param);
+
+/******************************************************************************
+ * @brief       Releases one payload decoded by a dll_decode_func_t.
+ * @param data  Data returned by the decoding function.
+ * @param param User parameter.
+******************************************************************************/
+typedef void (*dll_release_func_t) (void *data, void *param);
+
+/******************************************************************************
+ * @brief        Writes a list into a file.
+ * @param dll    Pointer to the list.
+ * @param path   Path of the file. The list is written to path.tmp first and
+ *               renamed over path, so snapshots already open keep the old
+ *               file, which is left intact if writing fails.
+ * @param encode Payload encoding function.
+ * @param param  Parameter to be passed to the encoding function.
+ * @return       0 on success, -1 on failure.
+ * Complexity    Time complexity: O(n), Space complexity: O(1).
+******************************************************************************/
+int DLLSerialize(const dll_t *dll, const char *path, dll_encode_func_t encode, void *param);
+
+/******************************************************************************
+ * @brief         Rebuilds a list from a file written by DLLSerialize.
+ * @param path    Path of the file.
+ * @param decode  Payload decoding function.
+ * @param release Function releasing the data already decoded when rebuilding
+ *                fails partway, or NULL if the data own nothing.
+ * @param param   Parameter to be passed to the decoding and release functions.
+ * @return        Pointer to the new list, or NULL if the file is invalid or
+ *                corrupted, or on failure.
+ * Complexity     Time complexity: O(n), Space complexity: O(n).
+******************************************************************************/
+dll_t *DLLDeserialize(const char *path, dll_decode_func_t decode,
+                      dll_release_func_t release, void *param);
+
+/******************************************************************************
+ * @brief        Maps a file written by DLLSerialize as a read-only snapshot.
+ * @param path   Path of the file.
+ * @param verify Non-zero to validate the checksum and every link of the file
+ *               before returning, O(n). Zero trusts the file and only checks
+ *               its header, O(1).
+ * @return       Pointer to the snapshot, or NULL if invalid or on failure.
+ * Complexity    Time complexity: O(1) or O(n), Space complexity: O(1).
+******************************************************************************/
+dll_snapshot_t *DLLSnapshotOpen(const char *path, int verify);
+
+/******************************************************************************
+ * @brief          Unmaps a snapshot. Its iterators become invalid.
+ * @param snapshot Pointer to the snapshot.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+void DLLSnapshotClose(dll_snapshot_t *snapshot);
+
+/******************************************************************************
+ * @brief          Returns the number of records of a snapshot.
+ * @param snapshot Pointer to the snapshot.
+ * @return         Number of records.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+size_t DLLSnapshotCount(const dll_snapshot_t *snapshot);
+
+/******************************************************************************
+ * @brief          Returns an iterator pointing to the first record.
+ * @param snapshot Pointer to the snapshot.
+ * @return         Iterator pointing to the start of the snapshot.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_snap_iter_t DLLSnapshotBegin(const dll_snapshot_t *snapshot);
+
+/******************************************************************************
+ * @brief          Returns an iterator pointing to the end of the snapshot.
+ * @param snapshot Pointer to the snapshot.
+ * @return         Iterator pointing to the end of the snapshot.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_snap_iter_t DLLSnapshotEnd(const dll_snapshot_t *snapshot);
+
+/******************************************************************************
+ * @brief          Returns the next iterator.
+ * @param iterator Iterator.
+ * @return         Next iterator, or NULL after the end.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_snap_iter_t DLLSnapshotNext(dll_snap_iter_t iterator);
+
+/******************************************************************************
+ * @brief          Returns the previous iterator.
+ * @param iterator Iterator.
+ * @return         Previous iterator, or NULL before the start.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_snap_iter_t DLLSnapshotPrev(dll_snap_iter_t iterator);
+
+/******************************************************************************
+ * @brief          Gets the encoded payload of a record, in place.
+ * @param iterator Iterator pointing to the record.
+ * @param size     Output, size of the payload in bytes. May be NULL.
+ * @return         Pointer to the payload, valid until the snapshot is closed.
+ * Complexity      Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+const void *DLLSnapshotGetData(dll_snap_iter_t iterator, size_t *size);
+
+#endif /* __DLL_SERIALIZE_H__ */
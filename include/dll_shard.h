@@ -0,0 +1,101 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This is the header for a pool of data split into shards, each
+ *               one a doubly linked list with its own lock and its own cache of
+ *               spare nodes. A thread pushes to and pops from its own shard, so
+ *               threads on different shards never contend, and pops from the
+ *               other shards only when its own is empty.
+ *
+ *               A thread is given a shard on its first use of any pool, round
+ *               robin, unless it binds itself to one first. On a NUMA machine,
+ *               creating a pool with a shard per node and binding every thread
+ *               to the node it runs on keeps each shard, its nodes and their
+ *               cache within one node.
+ *
+ *               Popped nodes are kept in the cache of the shard they belong
+ *               to, even when popped by another thread, and reused by its next
+ *               pushes. Count and ForEach visit all the shards, one at a time.
+ ******************************************************************************/
+#ifndef __DLL_SHARD_H__
+#define __DLL_SHARD_H__
+
+#include <stddef.h>   /* size_t, NULL     */
+
+#include "dll.h"      /* dll_act_func_t   */
+
+typedef struct dll_shard dll_shard_t;
+
+/******************************************************************************
+ * @brief           Creates a new sharded pool.
+ * @param shards    Number of shards, at least 1.
+ * @param cache_max Maximum number of spare nodes kept by each shard.
+ * @return          Pointer to the created pool, or NULL if creation fails.
+ * Complexity       Time complexity: O(shards), Space complexity: O(shards).
+******************************************************************************/
+dll_shard_t *DLLShardCreate(size_t shards, size_t cache_max);
+
+/******************************************************************************
+ * @brief      Destroys a sharded pool, its shards and their caches. No other
+ *             thread may use the pool any more.
+ * @param pool Pointer to the pool to be destroyed.
+ * Complexity  Time complexity: O(n), Space complexity: O(1).
+******************************************************************************/
+void DLLShardDestroy(dll_shard_t *pool);
+
+/******************************************************************************
+ * @brief       Binds the calling thread to a shard of every pool, the one of
+ *              index modulo the number of shards.
+ * @param index Index of the shard, e.g. the NUMA node of the thread.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+void DLLShardBindThread(size_t index);
+
+/******************************************************************************
+ * @brief      Pushes data to the shard of the calling thread, reusing a spare
+ *             node of the shard if there is one.
+ * @param pool Pointer to the pool.
+ * @param data Pointer to the data to be pushed, not NULL.
+ * @return     0 on success, -1 if push fails.
+ * Complexity Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+int DLLShardPush(dll_shard_t *pool, void *data);
+
+/******************************************************************************
+ * @brief      Pops the data pushed last to the shard of the calling thread,
+ *             or if it is empty, the data pushed first to another shard.
+ * @param pool Pointer to the pool.
+ * @return     Pointer to the popped data, or NULL if every shard is empty.
+ * Complexity Time complexity: O(shards), Space complexity: O(1).
+******************************************************************************/
+void *DLLShardPop(dll_shard_t *pool);
+
+/******************************************************************************
+ * @brief      Counts the number of elements in all the shards.
+ * @param pool Pointer to the pool.
+ * @return     Number of elements, as seen by visiting each shard in turn.
+ * Complexity Time complexity: O(shards), Space complexity: O(1).
+******************************************************************************/
+size_t DLLShardCount(dll_shard_t *pool);
+
+/******************************************************************************
+ * @brief      Checks if all the shards are empty.
+ * @param pool Pointer to the pool.
+ * @return     1 if empty, 0 if not.
+ * Complexity Time complexity: O(shards), Space complexity: O(1).
+******************************************************************************/
+int DLLShardIsEmpty(dll_shard_t *pool);
+
+/******************************************************************************
+ * @brief       Performs an action on each data of all the shards, shard after
+ *              shard, holding the lock of the shard visited. The action must
+ *              not use the pool.
+ * @param pool  Pointer to the pool.
+ * @param act   Action function, given a pointer to the stored data.
+ * @param param Parameter to be passed to the action function.
+ * @return      0 on success, or the status returned by the action function.
+ * Complexity   Time complexity: O(n + shards), Space complexity: O(1).
+******************************************************************************/
+int DLLShardForEach(dll_shard_t *pool, dll_act_func_t act, void *param);
+
+#endif /* __DLL_SHARD_H__ */
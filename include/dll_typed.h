@@ -0,0 +1,385 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: Macro templates that generate a type-specialized doubly linked
+ *               list storing its payload inline in the node. DLL_DECLARE(name, T)
+ *               expands into static functions prefixed with name that mirror the
+ *               API and semantics of dll.h, with T in place of void *:
+ *
+ *                   DLL_DECLARE(intlist, int)
+ *
+ *                   intlist_t *list = intlistCreate();
+ *                   intlistPushBack(list, 42);
+ *
+ *               Since every function is generated in the including translation
+ *               unit, callbacks passed as constants can be inlined by the
+ *               compiler. DLL_DECLARE_FIND and DLL_DECLARE_FOREACH generate
+ *               variants with the predicate or action fixed at compile time for
+ *               when inlining must be guaranteed.
+ *
+ *               Unlike dll.h, iterators of a typed list stay valid until their
+ *               own node is removed. Both ends are guarded by dummy nodes, so
+ *               Next of End and Prev of Begin are dummies, never real elements.
+ ******************************************************************************/
+#ifndef __DLL_TYPED_H__
+#define __DLL_TYPED_H__
+
+#include <stdlib.h>   /* malloc, free */
+#include <string.h>   /* memset       */
+#include <assert.h>   /* assert       */
+#include <stddef.h>   /* size_t, NULL */
+
+#include "dll_compiler.h" /* DLL_INLINE */
+
+/******************************************************************************
+ * @brief      Declares a doubly linked list of T named name.
+ * @param name Prefix of the generated types and functions.
+ * @param T    Payload type, stored by value inside each node.
+ *
+ * Generated types:
+ *   name##_t, name##_iter_t,
+ *   name##_act_func_t : int (*)(T *data, void *param),
+ *   name##_cmp_func_t : int (*)(const T *data, void *param), 0 on match.
+ *
+ * Generated functions (same contract as the dll.h function of the same name):
+ *   Create, Destroy, InsertAfter, InsertBefore, Remove, PushBack, PushFront,
+ *   PopBack, PopFront, SetData, GetData, Begin, End, Next, Prev, IsEmpty,
+ *   IterIsEqual, Count, ForEach, Splice, Find, MultiFind.
+******************************************************************************/
+#define DLL_DECLARE(name, T)                                                   \
+                                                                               \
+typedef struct name##_node                                                     \
+{                                                                              \
+	T data;                                                                    \
+	struct name##_node *next;                                                  \
+	struct name##_node *prev;                                                  \
+                                                                               \
+} name##_node_t;                                                               \
+                                                                               \
+typedef struct name                                                            \
+{                                                                              \
+	name##_node_t head;                                                        \
+	name##_node_t tail;                                                        \
+                                                                               \
+} name##_t;                                                                    \
+                                                                               \
+typedef name##_node_t *name##_iter_t;                                          \
+typedef int (*name##_act_func_t) (T *data, void *param);                       \
+typedef int (*name##_cmp_func_t) (const T *data, void *param);                 \
+                                                                               \
+DLL_INLINE name##_t *name##Create(void)                                        \
+{                                                                              \
+	name##_t *list = (name##_t *)malloc(sizeof(name##_t));                     \
+                                                                               \
+	if(NULL == list)                                                           \
+	{                                                                          \
+		return (NULL);                                                         \
+	}                                                                          \
+                                                                               \
+	/* The payload of the dummies is never exposed but is kept defined */     \
+	memset(list, 0, sizeof(name##_t));                                         \
+	list->head.prev = NULL;                                                    \
+	list->head.next = &list->tail;                                             \
+	list->tail.prev = &list->head;                                             \
+	list->tail.next = NULL;                                                    \
+                                                                               \
+	return (list);                                                             \
+}                                                                              \
+                                                                               \
+DLL_INLINE void name##Destroy(name##_t *list)                                  \
+{                                                                              \
+	name##_node_t *runner = NULL;                                              \
+	name##_node_t *next = NULL;                                                \
+	assert(list && "list isn't valid. Can not be freed.");                     \
+                                                                               \
+	for(runner = list->head.next; runner != &list->tail; runner = next)        \
+	{                                                                          \
+		next = runner->next;                                                   \
+		free(runner);                                                          \
+	}                                                                          \
+                                                                               \
+	free(list);                                                                \
+}                                                                              \
+                                                                               \
+DLL_INLINE name##_iter_t name##InsertBefore(name##_iter_t iterator, T data)    \
+{                                                                              \
+	name##_node_t *new_node = (name##_node_t *)malloc(sizeof(name##_node_t));  \
+	assert(iterator && iterator->prev && "Iterator isn't valid.");             \
+                                                                               \
+	if(NULL == new_node)                                                       \
+	{                                                                          \
+		while(iterator->next)                                                  \
+		{                                                                      \
+			iterator = iterator->next;                                         \
+		}                                                                      \
+                                                                               \
+		return (iterator);                                                     \
+	}                                                                          \
+                                                                               \
+	new_node->data = data;                                                     \
+	new_node->next = iterator;                                                 \
+	new_node->prev = iterator->prev;                                           \
+	iterator->prev->next = new_node;                                           \
+	iterator->prev = new_node;                                                 \
+                                                                               \
+	return (new_node);                                                         \
+}                                                                              \
+                                                                               \
+DLL_INLINE name##_iter_t name##InsertAfter(name##_iter_t iterator, T data)     \
+{                                                                              \
+	assert(iterator && iterator->next && "Iterator isn't valid.");             \
+	return (name##InsertBefore(iterator->next, data));                         \
+}                                                                              \
+                                                                               \
+DLL_INLINE name##_iter_t name##Remove(name##_iter_t iterator)                  \
+{                                                                              \
+	name##_node_t *next = NULL;                                                \
+	assert(iterator && iterator->next && iterator->prev &&                     \
+	       "Iterator isn't valid.");                                           \
+                                                                               \
+	next = iterator->next;                                                     \
+	iterator->prev->next = next;                                               \
+	next->prev = iterator->prev;                                               \
+	free(iterator);                                                            \
+                                                                               \
+	return (next);                                                             \
+}                                                                              \
+                                                                               \
+DLL_INLINE name##_iter_t name##PushBack(name##_t *list, T data)                \
+{                                                                              \
+	assert(list && "list isn't valid.");                                       \
+	return (name##InsertBefore(&list->tail, data));                            \
+}                                                                              \
+                                                                               \
+DLL_INLINE name##_iter_t name##PushFront(name##_t *list, T data)               \
+{                                                                              \
+	assert(list && "list isn't valid.");                                       \
+	return (name##InsertBefore(list->head.next, data));                        \
+}                                                                              \
+                                                                               \
+DLL_INLINE T name##PopBack(name##_t *list)                                     \
+{                                                                              \
+	T data;                                                                    \
+	assert(list && list->tail.prev != &list->head && "list isn't valid.");     \
+                                                                               \
+	data = list->tail.prev->data;                                              \
+	name##Remove(list->tail.prev);                                             \
+	return (data);                                                             \
+}                                                                              \
+                                                                               \
+DLL_INLINE T name##PopFront(name##_t *list)                                    \
+{                                                                              \
+	T data;                                                                    \
+	assert(list && list->head.next != &list->tail && "list isn't valid.");     \
+                                                                               \
+	data = list->head.next->data;                                              \
+	name##Remove(list->head.next);                                             \
+	return (data);                                                             \
+}                                                                              \
+                                                                               \
+DLL_INLINE void name##SetData(name##_iter_t iterator, T data)                  \
+{                                                                              \
+	assert(iterator && "Iterator isn't valid.");                               \
+	iterator->data = data;                                                     \
+}                                                                              \
+                                                                               \
+DLL_INLINE T name##GetData(const name##_iter_t iterator)                       \
+{                                                                              \
+	assert(iterator && "Iterator isn't valid.");                               \
+	return (iterator->data);                                                   \
+}                                                                              \
+                                                                               \
+DLL_INLINE name##_iter_t name##Begin(const name##_t *list)                     \
+{                                                                              \
+	assert(list && "list isn't valid.");                                       \
+	return (list->head.next);                                                  \
+}                                                                              \
+                                                                               \
+DLL_INLINE name##_iter_t name##End(const name##_t *list)                       \
+{                                                                              \
+	assert(list && "list isn't valid.");                                       \
+	return ((name##_iter_t)&list->tail);                                       \
+}                                                                              \
+                                                                               \
+DLL_INLINE name##_iter_t name##Next(const name##_iter_t iterator)              \
+{                                                                              \
+	assert(iterator && "Iterator isn't valid.");                               \
+	return (iterator->next);                                                   \
+}                                                                              \
+                                                                               \
+DLL_INLINE name##_iter_t name##Prev(const name##_iter_t iterator)              \
+{                                                                              \
+	assert(iterator && "Iterator isn't valid.");                               \
+	return (iterator->prev);                                                   \
+}                                                                              \
+                                                                               \
+DLL_INLINE int name##IsEmpty(const name##_t *list)                             \
+{                                                                              \
+	assert(list && "list isn't valid.");                                       \
+	return (list->head.next == &list->tail);                                   \
+}                                                                              \
+                                                                               \
+DLL_INLINE int name##IterIsEqual(const name##_iter_t iter1,                    \
+                                 const name##_iter_t iter2)                    \
+{                                                                              \
+	assert(iter1 && "First iterator isn't valid.");                            \
+	assert(iter2 && "Second iterator isn't valid.");                           \
+	return (iter1 == iter2);                                                   \
+}                                                                              \
+                                                                               \
+DLL_INLINE size_t name##Count(const name##_t *list)                            \
+{                                                                              \
+	size_t count = 0;                                                          \
+	const name##_node_t *runner = NULL;                                        \
+	assert(list && "list isn't valid.");                                       \
+                                                                               \
+	for(runner = list->head.next; runner != &list->tail; runner = runner->next)\
+	{                                                                          \
+		++count;                                                               \
+	}                                                                          \
+                                                                               \
+	return (count);                                                            \
+}                                                                              \
+                                                                               \
+DLL_INLINE int name##ForEach(name##_iter_t from, const name##_iter_t to,       \
+                             name##_act_func_t act, void *param)               \
+{                                                                              \
+	int status = 0;                                                            \
+	assert(from && "From iterator isn't valid.");                              \
+	assert(to && "To iterator isn't valid.");                                  \
+                                                                               \
+	for(; from != to; from = from->next)                                       \
+	{                                                                          \
+		if((status = act(&from->data, param)))                                 \
+		{                                                                      \
+			return (status);                                                   \
+		}                                                                      \
+	}                                                                          \
+                                                                               \
+	return (0);                                                                \
+}                                                                              \
+                                                                               \
+DLL_INLINE void name##Splice(name##_iter_t dest, name##_iter_t source_from,    \
+                             name##_iter_t source_to)                          \
+{                                                                              \
+	name##_node_t *last = NULL;                                                \
+	assert(dest && dest->prev && "Destination iterator isn't valid.");         \
+	assert(source_from && "From iterator isn't valid.");                       \
+	assert(source_to && "To iterator isn't valid.");                           \
+                                                                               \
+	if(source_from == source_to)                                               \
+	{                                                                          \
+		return;                                                                \
+	}                                                                          \
+                                                                               \
+	last = source_to->prev;                                                    \
+	source_from->prev->next = source_to;                                       \
+	source_to->prev = source_from->prev;                                       \
+                                                                               \
+	source_from->prev = dest->prev;                                            \
+	last->next = dest;                                                         \
+	dest->prev->next = source_from;                                            \
+	dest->prev = last;                                                         \
+}                                                                              \
+                                                                               \
+DLL_INLINE name##_iter_t name##Find(const name##_iter_t from,                  \
+                                    const name##_iter_t to,                    \
+                                    name##_cmp_func_t cmp, void *param)        \
+{                                                                              \
+	name##_iter_t runner = from;                                               \
+	assert(from && "From iterator isn't valid.");                              \
+	assert(to && "To iterator isn't valid.");                                  \
+                                                                               \
+	for(; runner != to; runner = runner->next)                                 \
+	{                                                                          \
+		if(!cmp(&runner->data, param))                                         \
+		{                                                                      \
+			return (runner);                                                   \
+		}                                                                      \
+	}                                                                          \
+                                                                               \
+	return (to);                                                               \
+}                                                                              \
+                                                                               \
+DLL_INLINE int name##MultiFind(const name##_iter_t from,                       \
+                               const name##_iter_t to, name##_cmp_func_t cmp,  \
+                               void *param, name##_t *dest)                    \
+{                                                                              \
+	int status = 0;                                                            \
+	name##_iter_t runner = from;                                               \
+	assert(dest && "Destination isn't valid.");                                \
+	assert(from && "From iterator isn't valid.");                              \
+	assert(to && "To iterator isn't valid.");                                  \
+                                                                               \
+	for(; runner != to; runner = runner->next)                                 \
+	{                                                                          \
+		if(!cmp(&runner->data, param))                                         \
+		{                                                                      \
+			if(&dest->tail == name##PushBack(dest, runner->data))              \
+			{                                                                  \
+				return (-1);                                                   \
+			}                                                                  \
+                                                                               \
+			status++;                                                          \
+		}                                                                      \
+	}                                                                          \
+                                                                               \
+	return (status);                                                           \
+}
+
+/******************************************************************************
+ * @brief      Declares a find function of a typed list with a fixed predicate.
+ * @param name Prefix given to DLL_DECLARE.
+ * @param func Name of the generated function:
+ *             name##_iter_t func(from, to, void *param).
+ * @param pred Function or function-like macro called as pred(const T *, param),
+ *             returning 0 on match.
+******************************************************************************/
+#define DLL_DECLARE_FIND(name, func, pred)                                     \
+DLL_INLINE name##_iter_t func(const name##_iter_t from,                        \
+                              const name##_iter_t to, void *param)             \
+{                                                                              \
+	name##_iter_t runner = from;                                               \
+	assert(from && "From iterator isn't valid.");                              \
+	assert(to && "To iterator isn't valid.");                                  \
+	(void) param;                                                              \
+                                                                               \
+	for(; runner != to; runner = runner->next)                                 \
+	{                                                                          \
+		if(!pred(&runner->data, param))                                        \
+		{                                                                      \
+			return (runner);                                                   \
+		}                                                                      \
+	}                                                                          \
+                                                                               \
+	return (to);                                                               \
+}
+
+/******************************************************************************
+ * @brief      Declares a for-each function of a typed list with a fixed action.
+ * @param name Prefix given to DLL_DECLARE.
+ * @param func Name of the generated function:
+ *             int func(from, to, void *param).
+ * @param act  Function or function-like macro called as act(T *, param),
+ *             returning non-zero to stop the iteration.
+******************************************************************************/
+#define DLL_DECLARE_FOREACH(name, func, act)                                   \
+DLL_INLINE int func(name##_iter_t from, const name##_iter_t to, void *param)   \
+{                                                                              \
+	int status = 0;                                                            \
+	assert(from && "From iterator isn't valid.");                              \
+	assert(to && "To iterator isn't valid.");                                  \
+	(void) param;                                                              \
+                                                                               \
+	for(; from != to; from = from->next)                                       \
+	{                                                                          \
+		if((status = act(&from->data, param)))                                 \
+		{                                                                      \
+			return (status);                                                   \
+		}                                                                      \
+	}                                                                          \
+                                                                               \
+	return (0);                                                                \
+}
+
+#endif /* __DLL_TYPED_H__ */
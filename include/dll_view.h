@@ -0,0 +1,108 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This is the header for lazy views over a range of a doubly
+ *               linked list. A view is a range, or a filter, map, take or skip
+ *               over another view, and is pulled one data at a time with
+ *               DLLViewNext. Views live in storage given by the caller, so a
+ *               pipeline allocates nothing, and a data is only computed when
+ *               pulled: taking the first matches stops at the last one needed.
+ *
+ *               Filters keep the data for which the comparison function returns
+ *               0, as DLLFind does. A view keeps its position in the list, so
+ *               the list must not be modified while the view is in use.
+ ******************************************************************************/
+#ifndef __DLL_VIEW_H__
+#define __DLL_VIEW_H__
+
+#include <stddef.h>   /* size_t, NULL                 */
+
+#include "dll.h"      /* dll_iter_t, dll_cmp_func_t   */
+
+typedef void *(*dll_map_func_t) (void *data, void *param);
+
+typedef enum dll_view_kind
+{
+	DLL_VIEW_RANGE,
+	DLL_VIEW_FILTER,
+	DLL_VIEW_MAP,
+	DLL_VIEW_TAKE,
+	DLL_VIEW_SKIP
+
+} dll_view_kind_t;
+
+typedef struct dll_view
+{
+	dll_view_kind_t kind;
+	struct dll_view *source;
+	dll_iter_t position;
+	dll_iter_t to;
+	dll_cmp_func_t cmp;
+	dll_map_func_t map;
+	void *param;
+	size_t count;
+
+} dll_view_t;
+
+/******************************************************************************
+ * @brief      Sets up a view of the data of a range.
+ * @param view Storage of the view.
+ * @param from Iterator pointing to the start of the range.
+ * @param to   Iterator pointing to the end of the range (not included).
+ * @return     Pointer to the view.
+ * Complexity  Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_view_t *DLLViewRange(dll_view_t *view, dll_iter_t from, dll_iter_t to);
+
+/******************************************************************************
+ * @brief        Sets up a view of the data of another view that match.
+ * @param view   Storage of the view.
+ * @param source View to filter, pulled by this view only.
+ * @param cmp    Comparison function, returning 0 for the data to keep.
+ * @param param  Parameter to be passed to the comparison function.
+ * @return       Pointer to the view.
+ * Complexity    Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_view_t *DLLViewFilter(dll_view_t *view, dll_view_t *source, dll_cmp_func_t cmp, void *param);
+
+/******************************************************************************
+ * @brief        Sets up a view of the data of another view transformed.
+ * @param view   Storage of the view.
+ * @param source View to transform, pulled by this view only.
+ * @param map    Function returning the transformed data.
+ * @param param  Parameter to be passed to the function.
+ * @return       Pointer to the view.
+ * Complexity    Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_view_t *DLLViewMap(dll_view_t *view, dll_view_t *source, dll_map_func_t map, void *param);
+
+/******************************************************************************
+ * @brief        Sets up a view of the first data of another view.
+ * @param view   Storage of the view.
+ * @param source View to take from, pulled by this view only.
+ * @param count  Maximum number of data.
+ * @return       Pointer to the view.
+ * Complexity    Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_view_t *DLLViewTake(dll_view_t *view, dll_view_t *source, size_t count);
+
+/******************************************************************************
+ * @brief        Sets up a view of the data of another view after its first.
+ * @param view   Storage of the view.
+ * @param source View to skip from, pulled by this view only.
+ * @param count  Number of data to skip.
+ * @return       Pointer to the view.
+ * Complexity    Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+dll_view_t *DLLViewSkip(dll_view_t *view, dll_view_t *source, size_t count);
+
+/******************************************************************************
+ * @brief      Pulls the next data of a view.
+ * @param view Pointer to the view.
+ * @param data Set to the next data.
+ * @return     1 if a data was pulled, 0 if the view is exhausted.
+ * Complexity  Time complexity: O(nodes visited), Space complexity: O(1).
+******************************************************************************/
+int DLLViewNext(dll_view_t *view, void **data);
+
+#endif /* __DLL_VIEW_H__ */
@@ -0,0 +1,118 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This is the header for a mergeable priority queue implemented
+ *               as a Fibonacci heap. The root list and the children lists of the
+ *               heap are doubly linked lists, melded and consolidated with
+ *               DLLSplice so that no list operation allocates after insertion.
+ *
+ *               Elements are ordered by a dll_cmp_func_t comparator, called as
+ *               cmp(data, other), returning a negative value when data comes
+ *               first. Insert returns a handle used to decrease the key of an
+ *               element or remove it, valid until the element leaves the heap.
+ ******************************************************************************/
+#ifndef __FIB_HEAP_H__
+#define __FIB_HEAP_H__
+
+#include <stddef.h>   /* size_t, NULL    */
+
+#include "dll.h"      /* dll_cmp_func_t  */
+
+typedef struct fib_heap fib_heap_t;
+
+typedef struct fib_handle fib_handle_t;
+
+/******************************************************************************
+ * @brief     Creates a new heap.
+ * @param cmp Comparison function, negative when its first argument comes first.
+ * @return    Pointer to the created heap, or NULL if creation fails.
+ * Complexity Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+fib_heap_t *FibHeapCreate(dll_cmp_func_t cmp);
+
+/******************************************************************************
+ * @brief      Destroys a heap. Its handles become invalid.
+ * @param heap Pointer to the heap to be destroyed.
+ * Complexity  Time complexity: O(n), Space complexity: O(1).
+******************************************************************************/
+void FibHeapDestroy(fib_heap_t *heap);
+
+/******************************************************************************
+ * @brief      Inserts data into the heap.
+ * @param heap Pointer to the heap.
+ * @param data Pointer to the data to be inserted.
+ * @return     Handle of the element, or NULL if insertion fails.
+ * Complexity  Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+fib_handle_t *FibHeapInsert(fib_heap_t *heap, void *data);
+
+/******************************************************************************
+ * @brief      Returns the first data of the heap without removing it.
+ * @param heap Pointer to the heap, not empty.
+ * @return     Pointer to the first data.
+ * Complexity  Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+void *FibHeapPeek(const fib_heap_t *heap);
+
+/******************************************************************************
+ * @brief      Removes the first data of the heap.
+ * @param heap Pointer to the heap, not empty.
+ * @return     Pointer to the popped data.
+ * Complexity  Time complexity: O(log n) amortized, Space complexity: O(1).
+******************************************************************************/
+void *FibHeapPop(fib_heap_t *heap);
+
+/******************************************************************************
+ * @brief        Moves every element of a heap into another and destroys it.
+ *               Both heaps must use the same comparison function. Handles of
+ *               source stay valid and now belong to dest.
+ * @param dest   Pointer to the heap receiving the elements.
+ * @param source Pointer to the heap to be melded, destroyed.
+ * Complexity    Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+void FibHeapMeld(fib_heap_t *dest, fib_heap_t *source);
+
+/******************************************************************************
+ * @brief        Replaces the data of an element by data that does not come
+ *               after it.
+ * @param heap   Pointer to the heap.
+ * @param handle Handle of the element.
+ * @param data   Pointer to the new data.
+ * Complexity    Time complexity: O(1) amortized, Space complexity: O(1).
+******************************************************************************/
+void FibHeapDecreaseKey(fib_heap_t *heap, fib_handle_t *handle, void *data);
+
+/******************************************************************************
+ * @brief        Removes an element from the heap.
+ * @param heap   Pointer to the heap.
+ * @param handle Handle of the element.
+ * @return       Pointer to the removed data.
+ * Complexity    Time complexity: O(log n) amortized, Space complexity: O(1).
+******************************************************************************/
+void *FibHeapRemove(fib_heap_t *heap, fib_handle_t *handle);
+
+/******************************************************************************
+ * @brief        Gets the data of an element.
+ * @param handle Handle of the element.
+ * @return       Pointer to the data.
+ * Complexity    Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+void *FibHeapGetData(const fib_handle_t *handle);
+
+/******************************************************************************
+ * @brief      Counts the elements of the heap.
+ * @param heap Pointer to the heap.
+ * @return     Number of elements.
+ * Complexity  Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+size_t FibHeapSize(const fib_heap_t *heap);
+
+/******************************************************************************
+ * @brief      Checks if the heap is empty.
+ * @param heap Pointer to the heap.
+ * @return     1 if empty, 0 if not.
+ * Complexity  Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+int FibHeapIsEmpty(const fib_heap_t *heap);
+
+#endif /* __FIB_HEAP_H__ */
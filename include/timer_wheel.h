@@ -0,0 +1,88 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This is the header for a hashed hierarchical timer wheel whose
+ *               slots are doubly linked lists. Time is counted in ticks and only
+ *               moves with TimerWheelAdvance. Scheduling and cancelling are O(1)
+ *               through the handle returned by TimerWheelSchedule; expiring and
+ *               cascading detach a whole slot at once with DLLSplice.
+ *
+ *               The wheel has 6 levels of 64 slots. A timer is kept in the
+ *               coarsest level its delay needs and moves to finer levels as its
+ *               expiry gets closer. Delays longer than 2^36 ticks are clamped.
+ ******************************************************************************/
+#ifndef __TIMER_WHEEL_H__
+#define __TIMER_WHEEL_H__
+
+#include <stddef.h>   /* size_t, NULL */
+
+typedef struct timer_wheel timer_wheel_t;
+
+typedef struct wheel_timer wheel_timer_t;
+
+typedef void (*timer_func_t) (void *param);
+
+/******************************************************************************
+ * @brief     Creates a new timer wheel at tick 0.
+ * @return    Pointer to the created wheel, or NULL if creation fails.
+ * Complexity Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+timer_wheel_t *TimerWheelCreate(void);
+
+/******************************************************************************
+ * @brief       Destroys a timer wheel. Pending timers are dropped without firing
+ *              and their handles become invalid.
+ * @param wheel Pointer to the wheel to be destroyed.
+ * Complexity   Time complexity: O(n), Space complexity: O(1).
+******************************************************************************/
+void TimerWheelDestroy(timer_wheel_t *wheel);
+
+/******************************************************************************
+ * @brief       Schedules a function to be called after a number of ticks.
+ * @param wheel Pointer to the wheel.
+ * @param ticks Delay in ticks, 0 is treated as 1.
+ * @param func  Function called when the timer expires.
+ * @param param Parameter to be passed to the function.
+ * @return      Handle of the timer, valid until it fires or is cancelled, or
+ *              NULL if scheduling fails.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+wheel_timer_t *TimerWheelSchedule(timer_wheel_t *wheel, size_t ticks, timer_func_t func, void *param);
+
+/******************************************************************************
+ * @brief       Cancels a pending timer and releases its handle. Cancelling the
+ *              timer currently firing has no effect.
+ * @param wheel Pointer to the wheel.
+ * @param timer Handle of a pending timer.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+void TimerWheelCancel(timer_wheel_t *wheel, wheel_timer_t *timer);
+
+/******************************************************************************
+ * @brief       Moves time forward, firing every timer that expires on the way,
+ *              tick by tick. Timers may be scheduled or cancelled from within
+ *              the fired functions.
+ * @param wheel Pointer to the wheel.
+ * @param ticks Number of ticks to move forward.
+ * @return      Number of timers fired.
+ * Complexity   Time complexity: O(ticks + fired), amortized over cascades.
+******************************************************************************/
+size_t TimerWheelAdvance(timer_wheel_t *wheel, size_t ticks);
+
+/******************************************************************************
+ * @brief       Returns the current tick of the wheel.
+ * @param wheel Pointer to the wheel.
+ * @return      Number of ticks since creation.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+size_t TimerWheelNow(const timer_wheel_t *wheel);
+
+/******************************************************************************
+ * @brief       Counts the pending timers of the wheel.
+ * @param wheel Pointer to the wheel.
+ * @return      Number of pending timers.
+ * Complexity   Time complexity: O(1), Space complexity: O(1).
+******************************************************************************/
+size_t TimerWheelCount(const timer_wheel_t *wheel);
+
+#endif /* __TIMER_WHEEL_H__ */
@@ -0,0 +1,424 @@
+/******************************************************************************
+ * @date:        18.10.2026
+
+ * @description: This implementation of the deque stores the data in a ring of
+ *               fixed-size chunks. The ring is indexed by absolute slots, so an
+ *               element is found with a mask and a shift. Chunks are allocated
+ *               on first use and kept for reuse until the deque is destroyed.
+ *
+******************************************************************************/
+#include <stdlib.h> /* malloc, calloc, free */
+#include <string.h> /* memcpy               */
+#include <assert.h> /* assert    :)         */
+
+#include "deque.h"  /* Internal use */
+/*****************************************************************************/
+/* Both must be powers of two */
+#define CHUNK_SIZE (64)
+#define INITIAL_CHUNKS (4)
+
+struct deque
+{
+	void ***map;
+	size_t map_size;
+	size_t begin;
+	size_t count;
+};
+
+static void **DequeSlot(const deque_t *deque, size_t index);
+static int DequeGrow(deque_t *deque);
+static int DequeReserveChunk(deque_t *deque, size_t index);
+/******************************************************************************
+ * @brief     Creates a new deque.
+ * @return    Pointer to the created deque, or NULL if creation fails.
+******************************************************************************/
+deque_t *DequeCreate(void)
+{
+	deque_t *deque = (deque_t *)malloc(sizeof(deque_t));
+
+	if(NULL == deque)
+	{
+		return (NULL);
+	}
+
+	deque->map = (void ***)calloc(INITIAL_CHUNKS, sizeof(void **));
+	if(NULL == deque->map)
+	{
+		free(deque);
+		return (NULL);
+	}
+
+	deque->map_size = INITIAL_CHUNKS;
+	deque->begin = 0;
+	deque->count = 0;
+
+	return (deque);
+}
+
+/******************************************************************************
+ * @brief       Destroys a deque and its chunks.
+ * @param deque Pointer to the deque to be destroyed.
+******************************************************************************/
+void DequeDestroy(deque_t *deque)
+{
+	size_t i = 0;
+
+	assert(deque && "Deque isn't valid. Can not be freed.");
+
+	for(; i < deque->map_size; ++i)
+	{
+		free(deque->map[i]);
+	}
+
+	free(deque->map);
+	free(deque);
+}
+
+/******************************************************************************
+ * @brief       Pushes data to the back of the deque.
+ * @param deque Pointer to the deque.
+ * @param data  Pointer to the data to be pushed.
+ * @return      0 on success, -1 if push fails.
+******************************************************************************/
+int DequePushBack(deque_t *deque, void *data)
+{
+	assert(deque && "Deque isn't valid.");
+
+	if(deque->count == deque->map_size * CHUNK_SIZE && DequeGrow(deque))
+	{
+		return (-1);
+	}
+
+	if(DequeReserveChunk(deque, deque->count))
+	{
+		return (-1);
+	}
+
+	*DequeSlot(deque, deque->count) = data;
+	++deque->count;
+
+	return (0);
+}
+
+/******************************************************************************
+ * @brief       Pushes data to the front of the deque.
+ * @param deque Pointer to the deque.
+ * @param data  Pointer to the data to be pushed.
+ * @return      0 on success, -1 if push fails.
+******************************************************************************/
+int DequePushFront(deque_t *deque, void *data)
+{
+	size_t mask = 0;
+
+	assert(deque && "Deque isn't valid.");
+
+	if(deque->count == deque->map_size * CHUNK_SIZE && DequeGrow(deque))
+	{
+		return (-1);
+	}
+
+	/* Index -1 of the ring is the slot before the front */
+	if(DequeReserveChunk(deque, (size_t)-1))
+	{
+		return (-1);
+	}
+
+	mask = deque->map_size * CHUNK_SIZE - 1;
+	deque->begin = (deque->begin - 1) & mask;
+	*DequeSlot(deque, 0) = data;
+	++deque->count;
+
+	return (0);
+}
+
+/******************************************************************************
+ * @brief       Pops data from the back of the deque.
+ * @param deque Pointer to the deque.
+ * @return      Pointer to the popped data.
+******************************************************************************/
+void *DequePopBack(deque_t *deque)
+{
+	assert(deque && "Deque isn't valid.");
+	assert(deque->count && "Deque is empty.");
+
+	--deque->count;
+	return (*DequeSlot(deque, deque->count));
+}
+
+/******************************************************************************
+ * @brief       Pops data from the front of the deque.
+ * @param deque Pointer to the deque.
+ * @return      Pointer to the popped data.
+******************************************************************************/
+void *DequePopFront(deque_t *deque)
+{
+	void *data = NULL;
+
+	assert(deque && "Deque isn't valid.");
+	assert(deque->count && "Deque is empty.");
+
+	data = *DequeSlot(deque, 0);
+	deque->begin = (deque->begin + 1) & (deque->map_size * CHUNK_SIZE - 1);
+	--deque->count;
+
+	return (data);
+}
+
+/******************************************************************************
+ * @brief       Gets the data at an index, 0 being the front.
+ * @param deque Pointer to the deque.
+ * @param index Index, lower than DequeCount.
+ * @return      Pointer to the data.
+******************************************************************************/
+void *DequeGet(const deque_t *deque, size_t index)
+{
+	assert(deque && "Deque isn't valid.");
+	assert(index < deque->count && "Index is out of range.");
+
+	return (*DequeSlot(deque, index));
+}
+
+/******************************************************************************
+ * @brief       Sets the data at an index, 0 being the front.
+ * @param deque Pointer to the deque.
+ * @param index Index, lower than DequeCount.
+ * @param data  Pointer to the new data to be set.
+******************************************************************************/
+void DequeSet(deque_t *deque, size_t index, void *data)
+{
+	assert(deque && "Deque isn't valid.");
+	assert(index < deque->count && "Index is out of range.");
+
+	*DequeSlot(deque, index) = data;
+}
+
+/******************************************************************************
+ * @brief       Counts the number of elements in the deque.
+ * @param deque Pointer to the deque.
+ * @return      Number of elements.
+******************************************************************************/
+size_t DequeCount(const deque_t *deque)
+{
+	assert(deque && "Deque isn't valid.");
+	return (deque->count);
+}
+
+/******************************************************************************
+ * @brief       Checks if the deque is empty.
+ * @param deque Pointer to the deque.
+ * @return      1 if empty, 0 if not.
+******************************************************************************/
+int DequeIsEmpty(const deque_t *deque)
+{
+	assert(deque && "Deque isn't valid.");
+	return (0 == deque->count);
+}
+
+/******************************************************************************
+ * @brief       Returns an iterator pointing to the front of the deque.
+ * @param deque Pointer to the deque.
+ * @return      Iterator pointing to the start of the deque.
+******************************************************************************/
+deque_iter_t DequeBegin(const deque_t *deque)
+{
+	deque_iter_t iterator;
+
+	assert(deque && "Deque isn't valid.");
+
+	iterator.deque = deque;
+	iterator.index = 0;
+	return (iterator);
+}
+
+/******************************************************************************
+ * @brief       Returns an iterator pointing past the back of the deque.
+ * @param deque Pointer to the deque.
+ * @return      Iterator pointing to the end of the deque.
+******************************************************************************/
+deque_iter_t DequeEnd(const deque_t *deque)
+{
+	deque_iter_t iterator;
+
+	assert(deque && "Deque isn't valid.");
+
+	iterator.deque = deque;
+	iterator.index = deque->count;
+	return (iterator);
+}
+
+/******************************************************************************
+ * @brief          Returns the next iterator.
+ * @param iterator Iterator.
+ * @return         Next iterator.
+******************************************************************************/
+deque_iter_t DequeNext(deque_iter_t iterator)
+{
+	assert(iterator.deque && "Iterator isn't valid.");
+
+	++iterator.index;
+	return (iterator);
+}
+
+/******************************************************************************
+ * @brief          Returns the previous iterator.
+ * @param iterator Iterator.
+ * @return         Previous iterator.
+******************************************************************************/
+deque_iter_t DequePrev(deque_iter_t iterator)
+{
+	assert(iterator.deque && "Iterator isn't valid.");
+
+	--iterator.index;
+	return (iterator);
+}
+
+/******************************************************************************
+ * @brief          Gets data from the element pointed by the given iterator.
+ * @param iterator Iterator pointing to an element.
+ * @return         Pointer to the data.
+******************************************************************************/
+void *DequeGetData(deque_iter_t iterator)
+{
+	return (DequeGet(iterator.deque, iterator.index));
+}
+
+/******************************************************************************
+ * @brief          Sets data of the element pointed by the given iterator.
+ * @param iterator Iterator pointing to an element.
+ * @param data     Pointer to the new data to be set.
+******************************************************************************/
+void DequeSetData(deque_iter_t iterator, void *data)
+{
+	DequeSet((deque_t *)iterator.deque, iterator.index, data);
+}
+
+/******************************************************************************
+ * @brief       Checks if two iterators are equal.
+ * @param iter1 Iterator.
+ * @param iter2 Iterator.
+ * @return      1 if equal, 0 if not.
+******************************************************************************/
+int DequeIterIsEqual(deque_iter_t iter1, deque_iter_t iter2)
+{
+	assert(iter1.deque && "First iterator isn't valid.");
+	assert(iter2.deque && "Second iterator isn't valid.");
+
+	return (iter1.deque == iter2.deque && iter1.index == iter2.index);
+}
+
+/******************************************************************************
+ * @brief       Iterates through a range and performs an action on each data,
+ *              a whole chunk at a time.
+ * @param from  Iterator pointing to the start of the range.
+ * @param to    Iterator pointing to the end of the range (not included).
+ * @param act   Action function, given a pointer to the stored data.
+ * @param param Parameter to be passed to the action function.
+ * @return      0 on success, or the status returned by the action function.
+******************************************************************************/
+int DequeForEach(deque_iter_t from, deque_iter_t to, deque_act_func_t act, void *param)
+{
+	void **slot = NULL;
+	void **chunk_end = NULL;
+	size_t index = from.index;
+	size_t run = 0;
+	int status = 0;
+
+	assert(from.deque && from.deque == to.deque && "Iterators aren't valid.");
+	assert(from.index <= to.index && to.index <= from.deque->count && "Range isn't valid.");
+
+	while(index < to.index)
+	{
+		/* Walking the contiguous run of slots left in the current chunk */
+		slot = DequeSlot(from.deque, index);
+		run = CHUNK_SIZE - ((from.deque->begin + index) % CHUNK_SIZE);
+		run = (run < to.index - index) ? run : to.index - index;
+		index += run;
+
+		for(chunk_end = slot + run; slot != chunk_end; ++slot)
+		{
+			if((status = act(slot, param)))
+			{
+				return (status);
+			}
+		}
+	}
+
+	return (0);
+}
+
+/******************************************************************************
+ * @brief       Returns the slot of an index, 0 being the front.
+ * @param deque Pointer to the deque.
+ * @param index Index, may be one past either end.
+ * @return      Pointer to the slot.
+******************************************************************************/
+static void **DequeSlot(const deque_t *deque, size_t index)
+{
+	size_t slot = (deque->begin + index) & (deque->map_size * CHUNK_SIZE - 1);
+	return (&deque->map[slot / CHUNK_SIZE][slot % CHUNK_SIZE]);
+}
+
+/******************************************************************************
+ * @brief       Makes sure the chunk holding an index is allocated.
+ * @param deque Pointer to the deque.
+ * @param index Index, may be one past either end.
+ * @return      0 on success, -1 on failure.
+******************************************************************************/
+static int DequeReserveChunk(deque_t *deque, size_t index)
+{
+	size_t slot = (deque->begin + index) & (deque->map_size * CHUNK_SIZE - 1);
+	void ***chunk = &deque->map[slot / CHUNK_SIZE];
+
+	if(NULL == *chunk)
+	{
+		*chunk = (void **)malloc(CHUNK_SIZE * sizeof(void *));
+	}
+
+	return (*chunk ? 0 : -1);
+}
+
+/******************************************************************************
+ * @brief       Doubles the ring of a full deque, moving chunks and not data.
+ * @param deque Pointer to the deque.
+ * @return      0 on success, -1 on failure.
+ * Complexity   Time complexity: O(n / CHUNK_SIZE + CHUNK_SIZE).
+******************************************************************************/
+static int DequeGrow(deque_t *deque)
+{
+	size_t first = deque->begin / CHUNK_SIZE;
+	size_t offset = deque->begin % CHUNK_SIZE;
+	size_t i = 0;
+	void ***map = (void ***)calloc(deque->map_size * 2, sizeof(void **));
+
+	if(NULL == map)
+	{
+		return (-1);
+	}
+
+	/* The chunk of the front is first. When the front is not at the start of
+	   its chunk, the start of that chunk holds the back of the deque */
+	if(offset)
+	{
+		map[deque->map_size] = (void **)malloc(CHUNK_SIZE * sizeof(void *));
+		if(NULL == map[deque->map_size])
+		{
+			free(map);
+			return (-1);
+		}
+
+		memcpy(map[deque->map_size], deque->map[first], offset * sizeof(void *));
+	}
+
+	for(; i < deque->map_size; ++i)
+	{
+		map[i] = deque->map[(first + i) & (deque->map_size - 1)];
+	}
+
+	free(deque->map);
+	deque->map = map;
+	deque->map_size *= 2;
+	deque->begin = offset;
+
+	return (0);
+}
+/*****************************************************************************/
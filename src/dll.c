@@ -11,24 +11,29 @@
 #include <stdlib.h> /* malloc, free  */
 #include <assert.h> /* assert    :)  */
 
-#include "dll.h"    /* Internal use */
+#include "dll.h"          /* Internal use */
+#include "dll_inline.h"   /* dll_node_t, struct dll */
+#include "dll_compiler.h" /* DLL_THREAD_LOCAL */
 /*****************************************************************************/
-typedef struct dll_node
+struct dll_cursor
 {
-	void *data;
-	struct dll_node *next;
-	struct dll_node *prev;
-
-} dll_node_t;
-
-struct dll
-{
-	dll_node_t *head;
-	dll_node_t *tail;
+	dll_node_t *position;
+	dll_node_t *current;
+	dll_node_t *to;
+	dll_act_func_t act;
+	void *param;
+	dll_cursor_t *prev;
+	dll_cursor_t *next;
 };
 
+/* Cursors are kept up to date by the mutations of the thread creating them */
+static DLL_THREAD_LOCAL dll_cursor_t *active_cursors = NULL;
+
 int Action(void *data, void *param);
 static void DLLSwap(dll_iter_t iter1, dll_iter_t iter2);
+static void DLLCursorsFollow(dll_node_t *from, dll_node_t *to);
+static void DLLCursorsSplice(dll_node_t *dest, dll_node_t *source_from, dll_node_t *source_to);
+static dll_node_t *SpliceFollow(dll_node_t *node, dll_node_t *dest, dll_node_t *source_from, dll_node_t *source_to);
 /******************************************************************************
  * @brief     Creates a new doubly linked list.
  * @return    Pointer to the created list, or NULL if creation fails.
@@ -131,6 +136,11 @@ dll_iter_t DLLInsertBefore(dll_iter_t iterator, void *data)
 	new_node->next = iterator->next;
 	iterator->next = new_node;
 
+	if(NULL != active_cursors)
+	{
+		DLLCursorsFollow(iterator, new_node);
+	}
+
 	return (iterator);
 }
 
@@ -155,6 +165,11 @@ dll_iter_t DLLRemove(dll_iter_t iterator)
 		iterator->next->prev = iterator;
 	}
 
+	if(NULL != active_cursors)
+	{
+		DLLCursorsFollow(tmp, iterator);
+	}
+
 	free(tmp);
 	return (iterator);
 }
@@ -171,6 +186,69 @@ dll_iter_t DLLPushBack(dll_t *dll, void *data)
 	return (DLLInsertBefore(dll->tail, data)); 
 }
 
+/******************************************************************************
+ * @brief       Pushes an array of data to the back of the doubly linked list,
+ *              linking all the new nodes in a single pass.
+ * @param dll   Pointer to the list.
+ * @param data  Array of pointers to the data to be pushed, in order.
+ * @param count Number of elements in data.
+ * @return      Iterator pointing to the first pushed node, or end of the list
+ *              if push fails.
+******************************************************************************/
+dll_iter_t DLLPushBackMany(dll_t *dll, void **data, size_t count)
+{
+	dll_node_t *first = NULL;
+	dll_node_t *chain = NULL;
+	dll_node_t *node = NULL;
+	size_t i = 0;
+
+	assert(dll && "dll isn't valid.");
+	assert((data || !count) && "Data isn't valid.");
+
+	first = dll->tail;
+
+	/* Allocating every node first, so a failure leaves the list untouched */
+	for(i = 0; i < count; ++i)
+	{
+		node = (dll_node_t *)malloc(sizeof(dll_node_t));
+		if(NULL == node)
+		{
+			while(chain)
+			{
+				node = chain->next;
+				free(chain);
+				chain = node;
+			}
+
+			return (dll->tail);
+		}
+
+		node->next = chain;
+		chain = node;
+	}
+
+	/* The old dummy takes the first data, the last new node becomes the dummy */
+	for(i = 0; i < count; ++i)
+	{
+		node = chain;
+		chain = chain->next;
+
+		node->data = dll->tail->data;
+		node->prev = dll->tail;
+		node->next = NULL;
+		dll->tail->data = data[i];
+		dll->tail->next = node;
+		dll->tail = node;
+	}
+
+	if(NULL != active_cursors)
+	{
+		DLLCursorsFollow(first, dll->tail);
+	}
+
+	return (first);
+}
+
 /******************************************************************************
  * @brief      Pushes data to the front of the doubly linked list.
  * @param dll  Pointer to the list.
@@ -355,6 +433,12 @@ void DLLSplice(dll_iter_t dest, dll_iter_t source_from, dll_iter_t source_to)
 	assert(source_from && "From iterator isn't valid.");
 	assert(source_to && "To iterator isn't valid.");
 
+	/* Nothing moves, and the exchanges below would mix up the data */
+	if(source_from == source_to || dest == source_from || dest == source_to)
+	{
+		return;
+	}
+
 	source_from->data = source_to->data;
 	source_to->data = dest->data;
 	dest->data = tmp1;
@@ -382,6 +466,44 @@ void DLLSplice(dll_iter_t dest, dll_iter_t source_from, dll_iter_t source_to)
 	{
 		source_to->next->prev = source_to;
 	}
+
+	if(NULL != active_cursors)
+	{
+		DLLCursorsSplice(dest, source_from, source_to);
+	}
+}
+
+/******************************************************************************
+ * @brief          Removes a node, returning the data moved into it.
+ * @param iterator Iterator pointing to the node to be removed.
+ * @return         Data now held by the node of iterator, or NULL if it became
+ *                 the end of the list.
+******************************************************************************/
+void *DLLRemoveGetMoved(dll_iter_t iterator)
+{
+	assert(iterator && "Iterator isn't valid.");
+
+	DLLRemove(iterator);
+
+	/* The data of the dummy end are the list, not user data */
+	return ((NULL == iterator->next) ? NULL : iterator->data);
+}
+
+/******************************************************************************
+ * @brief             Splices nodes, returning the data moved into source_from.
+ * @param dest        Iterator pointing to the destination position.
+ * @param source_from Iterator pointing to the start of the source range.
+ * @param source_to   Iterator pointing to the end of the source range (not included).
+ * @return            Data now held by the node of source_from, or NULL if it
+ *                    became the end of a list.
+******************************************************************************/
+void *DLLSpliceGetMoved(dll_iter_t dest, dll_iter_t source_from, dll_iter_t source_to)
+{
+	assert(source_from && "From iterator isn't valid.");
+
+	DLLSplice(dest, source_from, source_to);
+
+	return ((NULL == source_from->next) ? NULL : source_from->data);
 }
 
 /******************************************************************************
@@ -434,15 +556,18 @@ int DLLMultiFind(const dll_iter_t from, const dll_iter_t to, dll_cmp_func_t cmp,
 	{
 		found = DLLFind(found, to, cmp, param);
 
-		if(to != found)
+		/* Stepping past to would run off the end of the list */
+		if(to == found)
 		{
-			if(NULL == DLLPushBack(dest, found)->next)
-			{
-				return (-1);
-			}
+			break;
+		}
 
-			status++;
+		if(NULL == DLLPushBack(dest, found)->next)
+		{
+			return (-1);
 		}
+
+		status++;
 	}
 
 	return (status);
@@ -462,30 +587,37 @@ int Action(void *data, void *param)
 }
 
 /******************************************************************************
- * @brief       Arranges the elements in the list around a pivot value.
- * @param dll   Pointer to the list.
+ * @brief       Arranges the elements in the list around a pivot value: lower
+ *              values first, then equal ones, then greater ones.
+ * @param dll   Pointer to the list, whose data point to int.
  * @param pivot Pointer to the pivot value.
 ******************************************************************************/
 void DLLArrange(dll_t *dll, void *pivot)
 {
-    dll_iter_t left = DLLBegin(dll);
-    dll_iter_t right = DLLPrev(DLLEnd(dll));
-    int piv = *(int *)pivot;
-
-    while (left != right && left != DLLNext(right))
-    {
-        while (left != right && *(int *)left->data < piv)
-        {
-            left = DLLNext(left);
-        }
+	dll_iter_t lower_end = DLLBegin(dll);
+	dll_iter_t runner = DLLBegin(dll);
+	dll_iter_t greater_begin = DLLEnd(dll);
+	int piv = *(int *)pivot;
 
-        while (left != right && *(int *)right->data > piv)
-        {
-            right = DLLPrev(right);
-        }
-
-        DLLSwap(left, right);
-    }
+	/* [begin, lower_end) is lower, [runner, greater_begin) is not arranged yet */
+	while(runner != greater_begin)
+	{
+		if(*(int *)runner->data < piv)
+		{
+			DLLSwap(lower_end, runner);
+			lower_end = DLLNext(lower_end);
+			runner = DLLNext(runner);
+		}
+		else if(*(int *)runner->data > piv)
+		{
+			greater_begin = DLLPrev(greater_begin);
+			DLLSwap(runner, greater_begin);
+		}
+		else
+		{
+			runner = DLLNext(runner);
+		}
+	}
 }
 
 /******************************************************************************
@@ -506,4 +638,182 @@ static void DLLSwap(dll_iter_t iter1, dll_iter_t iter2)
     iter1->data = iter2->data;
     iter2->data = tempData;
 }
+
+/******************************************************************************
+ * @brief       Creates a cursor performing an action on each data of a range,
+ *              a bounded number of nodes at a time.
+ * @param from  Iterator pointing to the start of the range.
+ * @param to    Iterator pointing to the end of the range (not included).
+ * @param act   Action function to be performed on each data element.
+ * @param param Parameter to be passed to the action function.
+ * @return      Pointer to the cursor, or NULL if creation fails.
+******************************************************************************/
+dll_cursor_t *DLLCursorCreate(dll_iter_t from, dll_iter_t to, dll_act_func_t act, void *param)
+{
+	dll_cursor_t *cursor = (dll_cursor_t *)malloc(sizeof(dll_cursor_t));
+
+	assert(from && "From iterator isn't valid.");
+	assert(to && "To iterator isn't valid.");
+	assert(act && "Action function isn't valid.");
+
+	if(NULL == cursor)
+	{
+		return (NULL);
+	}
+
+	cursor->position = from;
+	cursor->current = NULL;
+	cursor->to = to;
+	cursor->act = act;
+	cursor->param = param;
+
+	/* Registering the cursor so every mutation keeps it up to date */
+	cursor->prev = NULL;
+	cursor->next = active_cursors;
+	if(NULL != active_cursors)
+	{
+		active_cursors->prev = cursor;
+	}
+
+	active_cursors = cursor;
+	return (cursor);
+}
+
+/******************************************************************************
+ * @brief        Destroys a cursor, finished or not.
+ * @param cursor Pointer to the cursor to be destroyed.
+******************************************************************************/
+void DLLCursorDestroy(dll_cursor_t *cursor)
+{
+	assert(cursor && "Cursor isn't valid. Can not be freed.");
+
+	if(NULL == cursor->prev)
+	{
+		active_cursors = cursor->next;
+	}
+	else
+	{
+		cursor->prev->next = cursor->next;
+	}
+
+	if(NULL != cursor->next)
+	{
+		cursor->next->prev = cursor->prev;
+	}
+
+	free(cursor);
+}
+
+/******************************************************************************
+ * @brief        Performs the action of a cursor on at most budget elements,
+ *               resuming where the previous step stopped.
+ * @param cursor Pointer to the cursor.
+ * @param budget Maximum number of elements to visit.
+ * @return       0 on success, or the status returned by the action function.
+******************************************************************************/
+int DLLCursorStep(dll_cursor_t *cursor, size_t budget)
+{
+	int status = 0;
+
+	assert(cursor && "Cursor isn't valid.");
+
+	for(; 0 < budget && !DLLCursorIsDone(cursor); --budget)
+	{
+		/* Moving on first, so the action may remove the element it is given */
+		cursor->current = cursor->position;
+		cursor->position = cursor->current->next;
+
+		if((status = cursor->act(&cursor->current->data, cursor->param)))
+		{
+			return (status);
+		}
+	}
+
+	return (0);
+}
+
+/******************************************************************************
+ * @brief        Checks if a cursor visited its whole range.
+ * @param cursor Pointer to the cursor.
+ * @return       1 if done, 0 if not.
+******************************************************************************/
+int DLLCursorIsDone(const dll_cursor_t *cursor)
+{
+	assert(cursor && "Cursor isn't valid.");
+
+	/* The end of a list stops a cursor whose range end was spliced away */
+	return (cursor->position == cursor->to || NULL == cursor->position->next);
+}
+
+/******************************************************************************
+ * @brief        Returns the iterator of the element the action of a cursor is
+ *               performed on.
+ * @param cursor Pointer to the cursor, within its action.
+ * @return       Iterator of the visited element, valid until the list changes.
+******************************************************************************/
+dll_iter_t DLLCursorCurrent(const dll_cursor_t *cursor)
+{
+	assert(cursor && "Cursor isn't valid.");
+	assert(cursor->current && "Cursor isn't within its action.");
+
+	return (cursor->current);
+}
+
+/******************************************************************************
+ * @brief      Moves the cursors referring to the element of a node to the node
+ *             the element moved to.
+ * @param from Node the element was in.
+ * @param to   Node the element is in.
+******************************************************************************/
+static void DLLCursorsFollow(dll_node_t *from, dll_node_t *to)
+{
+	dll_cursor_t *cursor = active_cursors;
+
+	for(; NULL != cursor; cursor = cursor->next)
+	{
+		if(from == cursor->position)
+		{
+			cursor->position = to;
+		}
+
+		if(from == cursor->to)
+		{
+			cursor->to = to;
+		}
+	}
+}
+
+/******************************************************************************
+ * @brief             Moves the cursors referring to the three elements moved
+ *                    between nodes by DLLSplice.
+ * @param dest        Destination iterator given to DLLSplice.
+ * @param source_from From iterator given to DLLSplice.
+ * @param source_to   To iterator given to DLLSplice.
+******************************************************************************/
+static void DLLCursorsSplice(dll_node_t *dest, dll_node_t *source_from, dll_node_t *source_to)
+{
+	dll_cursor_t *cursor = active_cursors;
+
+	for(; NULL != cursor; cursor = cursor->next)
+	{
+		cursor->position = SpliceFollow(cursor->position, dest, source_from, source_to);
+		cursor->to = SpliceFollow(cursor->to, dest, source_from, source_to);
+	}
+}
+
+/*****************************************************************************/
+static dll_node_t *SpliceFollow(dll_node_t *node, dll_node_t *dest, dll_node_t *source_from, dll_node_t *source_to)
+{
+	if(node == source_from)
+	{
+		return (dest);
+	}
+
+	if(node == source_to)
+	{
+		return (source_from);
+	}
+
+	return ((node == dest) ? source_to : node);
+}
 /*****************************************************************************/
\ No newline at end of file
@@ -0,0 +1,436 @@
+/******************************************************************************
+ * @date:        18.10.2026
+
+ * @description: This implementation of the channel keeps the data in a list
+ *               behind a mutex, and each direction in an eventfd whose counter
+ *               is 1 while it is ready and 0 otherwise. The counters are only
+ *               written when the readiness changes, under the mutex, so they
+ *               always match the list. A blocked thread polls its eventfd out
+ *               of the mutex and tries again when woken.
+ *
+******************************************************************************/
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdlib.h>       /* malloc, free      */
+#include <assert.h>       /* assert    :)      */
+#include <pthread.h>      /* pthread_mutex_t   */
+#include <poll.h>         /* poll              */
+#include <unistd.h>       /* close             */
+#include <sys/eventfd.h>  /* eventfd           */
+
+#include "dll.h"          /* Internal use */
+#include "dll_channel.h"  /* Internal use */
+/*****************************************************************************/
+struct dll_channel
+{
+	pthread_mutex_t lock;
+	dll_t *queue;
+	size_t count;
+	size_t capacity;
+	int is_closed;
+	int receive_fd;
+	int send_fd;
+	int can_receive;
+	int can_send;
+};
+
+static void UpdateReadiness(dll_channel_t *channel);
+static void SetReady(int fd, int *is_ready, int ready);
+static void WaitReady(int fd);
+/******************************************************************************
+ * @brief          Creates a new channel.
+ * @param capacity Maximum number of data in the channel, at least 1.
+ * @return         Pointer to the created channel, or NULL if creation fails.
+******************************************************************************/
+dll_channel_t *DLLChannelCreate(size_t capacity)
+{
+	dll_channel_t *channel = NULL;
+
+	assert(0 < capacity && "Capacity isn't valid.");
+
+	channel = (dll_channel_t *)malloc(sizeof(dll_channel_t));
+	if(NULL == channel)
+	{
+		return (NULL);
+	}
+
+	channel->queue = DLLCreate();
+	channel->receive_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	channel->send_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+	if(NULL == channel->queue || -1 == channel->receive_fd || -1 == channel->send_fd ||
+	   0 != pthread_mutex_init(&channel->lock, NULL))
+	{
+		if(NULL != channel->queue)
+		{
+			DLLDestroy(channel->queue);
+		}
+
+		if(-1 != channel->receive_fd)
+		{
+			close(channel->receive_fd);
+		}
+
+		if(-1 != channel->send_fd)
+		{
+			close(channel->send_fd);
+		}
+
+		free(channel);
+		return (NULL);
+	}
+
+	channel->count = 0;
+	channel->capacity = capacity;
+	channel->is_closed = 0;
+	channel->can_receive = 0;
+	channel->can_send = 0;
+	UpdateReadiness(channel);
+
+	return (channel);
+}
+
+/******************************************************************************
+ * @brief         Destroys a channel and its descriptors.
+ * @param channel Pointer to the channel to be destroyed.
+******************************************************************************/
+void DLLChannelDestroy(dll_channel_t *channel)
+{
+	assert(channel && "Channel isn't valid. Can not be freed.");
+
+	DLLDestroy(channel->queue);
+	close(channel->receive_fd);
+	close(channel->send_fd);
+	pthread_mutex_destroy(&channel->lock);
+	free(channel);
+}
+
+/******************************************************************************
+ * @brief         Sends data if the channel is not full, without blocking.
+ * @param channel Pointer to the channel.
+ * @param data    Pointer to the data to be sent.
+ * @return        DLL_CHANNEL_SUCCESS, DLL_CHANNEL_WOULD_BLOCK if full,
+ *                DLL_CHANNEL_CLOSED, or DLL_CHANNEL_FAILURE.
+******************************************************************************/
+dll_channel_status_t DLLChannelTrySend(dll_channel_t *channel, void *data)
+{
+	dll_channel_status_t status = DLL_CHANNEL_SUCCESS;
+
+	assert(channel && "Channel isn't valid.");
+
+	pthread_mutex_lock(&channel->lock);
+
+	if(channel->is_closed)
+	{
+		status = DLL_CHANNEL_CLOSED;
+	}
+	else if(channel->count == channel->capacity)
+	{
+		status = DLL_CHANNEL_WOULD_BLOCK;
+	}
+	else
+	{
+		/* Pushing allocates a node, and returns the end of the queue if it fails */
+		dll_iter_t pushed = DLLPushBack(channel->queue, data);
+
+		if(DLLIterIsEqual(pushed, DLLEnd(channel->queue)))
+		{
+			status = DLL_CHANNEL_FAILURE;
+		}
+		else
+		{
+			++channel->count;
+			UpdateReadiness(channel);
+		}
+	}
+
+	pthread_mutex_unlock(&channel->lock);
+
+	return (status);
+}
+
+/******************************************************************************
+ * @brief         Sends data, waiting while the channel is full.
+ * @param channel Pointer to the channel.
+ * @param data    Pointer to the data to be sent.
+ * @return        DLL_CHANNEL_SUCCESS, DLL_CHANNEL_CLOSED, or
+ *                DLL_CHANNEL_FAILURE.
+******************************************************************************/
+dll_channel_status_t DLLChannelSend(dll_channel_t *channel, void *data)
+{
+	dll_channel_status_t status = DLL_CHANNEL_WOULD_BLOCK;
+
+	while(DLL_CHANNEL_WOULD_BLOCK == (status = DLLChannelTrySend(channel, data)))
+	{
+		WaitReady(channel->send_fd);
+	}
+
+	return (status);
+}
+
+/******************************************************************************
+ * @brief         Sends an array of data in order, as many at a time as there
+ *                is room for, waiting while the channel is full.
+ * @param channel Pointer to the channel.
+ * @param data    Array of pointers to the data to be sent.
+ * @param count   Number of elements in data.
+ * @return        Number of data sent, lower than count only if the channel is
+ *                closed or on failure.
+******************************************************************************/
+size_t DLLChannelSendMany(dll_channel_t *channel, void **data, size_t count)
+{
+	size_t sent = 0;
+
+	assert(channel && "Channel isn't valid.");
+	assert((data || 0 == count) && "Data isn't valid.");
+
+	while(sent < count)
+	{
+		size_t room = 0;
+		int is_done = 0;
+
+		pthread_mutex_lock(&channel->lock);
+
+		room = channel->capacity - channel->count;
+		room = (count - sent < room) ? (count - sent) : room;
+		is_done = channel->is_closed;
+
+		if(!is_done && 0 < room)
+		{
+			dll_iter_t first = DLLPushBackMany(channel->queue, data + sent, room);
+
+			if(DLLIterIsEqual(first, DLLEnd(channel->queue)))
+			{
+				is_done = 1;
+			}
+			else
+			{
+				channel->count += room;
+				sent += room;
+				UpdateReadiness(channel);
+			}
+		}
+
+		pthread_mutex_unlock(&channel->lock);
+
+		if(is_done)
+		{
+			break;
+		}
+
+		if(0 == room)
+		{
+			WaitReady(channel->send_fd);
+		}
+	}
+
+	return (sent);
+}
+
+/******************************************************************************
+ * @brief         Receives the oldest data if the channel is not empty,
+ *                without blocking.
+ * @param channel Pointer to the channel.
+ * @param data    Set to the received data.
+ * @return        DLL_CHANNEL_SUCCESS, DLL_CHANNEL_WOULD_BLOCK if empty, or
+ *                DLL_CHANNEL_CLOSED if closed and empty.
+******************************************************************************/
+dll_channel_status_t DLLChannelTryReceive(dll_channel_t *channel, void **data)
+{
+	dll_channel_status_t status = DLL_CHANNEL_SUCCESS;
+
+	assert(channel && "Channel isn't valid.");
+	assert(data && "Data isn't valid.");
+
+	pthread_mutex_lock(&channel->lock);
+
+	if(0 < channel->count)
+	{
+		*data = DLLPopFront(channel->queue);
+		--channel->count;
+		UpdateReadiness(channel);
+	}
+	else
+	{
+		status = channel->is_closed ? DLL_CHANNEL_CLOSED : DLL_CHANNEL_WOULD_BLOCK;
+	}
+
+	pthread_mutex_unlock(&channel->lock);
+
+	return (status);
+}
+
+/******************************************************************************
+ * @brief         Receives the oldest data, waiting while the channel is empty.
+ * @param channel Pointer to the channel.
+ * @param data    Set to the received data.
+ * @return        DLL_CHANNEL_SUCCESS, or DLL_CHANNEL_CLOSED if closed and
+ *                empty.
+******************************************************************************/
+dll_channel_status_t DLLChannelReceive(dll_channel_t *channel, void **data)
+{
+	dll_channel_status_t status = DLL_CHANNEL_WOULD_BLOCK;
+
+	while(DLL_CHANNEL_WOULD_BLOCK == (status = DLLChannelTryReceive(channel, data)))
+	{
+		WaitReady(channel->receive_fd);
+	}
+
+	return (status);
+}
+
+/******************************************************************************
+ * @brief         Receives the oldest data, as many as there are up to max,
+ *                waiting while the channel is empty.
+ * @param channel Pointer to the channel.
+ * @param data    Array set to the received data, in order.
+ * @param max     Number of elements in data, at least 1.
+ * @return        Number of data received, 0 only if closed and empty.
+******************************************************************************/
+size_t DLLChannelReceiveMany(dll_channel_t *channel, void **data, size_t max)
+{
+	size_t received = 0;
+	int is_closed = 0;
+
+	assert(channel && "Channel isn't valid.");
+	assert(data && "Data isn't valid.");
+	assert(0 < max && "Max isn't valid.");
+
+	for(;;)
+	{
+		pthread_mutex_lock(&channel->lock);
+
+		for(; received < max && 0 < channel->count; ++received)
+		{
+			data[received] = DLLPopFront(channel->queue);
+			--channel->count;
+		}
+
+		UpdateReadiness(channel);
+		is_closed = channel->is_closed;
+
+		pthread_mutex_unlock(&channel->lock);
+
+		if(0 < received || is_closed)
+		{
+			return (received);
+		}
+
+		WaitReady(channel->receive_fd);
+	}
+}
+
+/******************************************************************************
+ * @brief         Closes a channel and wakes every thread waiting on it.
+ * @param channel Pointer to the channel.
+******************************************************************************/
+void DLLChannelClose(dll_channel_t *channel)
+{
+	assert(channel && "Channel isn't valid.");
+
+	pthread_mutex_lock(&channel->lock);
+	channel->is_closed = 1;
+	UpdateReadiness(channel);
+	pthread_mutex_unlock(&channel->lock);
+}
+
+/******************************************************************************
+ * @brief         Counts the number of data in the channel.
+ * @param channel Pointer to the channel.
+ * @return        Number of data, which other threads may change right away.
+******************************************************************************/
+size_t DLLChannelCount(dll_channel_t *channel)
+{
+	size_t count = 0;
+
+	assert(channel && "Channel isn't valid.");
+
+	pthread_mutex_lock(&channel->lock);
+	count = channel->count;
+	pthread_mutex_unlock(&channel->lock);
+
+	return (count);
+}
+
+/******************************************************************************
+ * @brief         Returns the descriptor readable while receiving would not
+ *                block.
+ * @param channel Pointer to the channel.
+ * @return        File descriptor.
+******************************************************************************/
+int DLLChannelReceiveFd(const dll_channel_t *channel)
+{
+	assert(channel && "Channel isn't valid.");
+	return (channel->receive_fd);
+}
+
+/******************************************************************************
+ * @brief         Returns the descriptor readable while sending would not
+ *                block.
+ * @param channel Pointer to the channel.
+ * @return        File descriptor.
+******************************************************************************/
+int DLLChannelSendFd(const dll_channel_t *channel)
+{
+	assert(channel && "Channel isn't valid.");
+	return (channel->send_fd);
+}
+
+/******************************************************************************
+ * @brief         Makes the descriptors of a locked channel match its state.
+ * @param channel Pointer to the locked channel.
+******************************************************************************/
+static void UpdateReadiness(dll_channel_t *channel)
+{
+	SetReady(channel->receive_fd, &channel->can_receive,
+	         0 < channel->count || channel->is_closed);
+	SetReady(channel->send_fd, &channel->can_send,
+	         channel->count < channel->capacity || channel->is_closed);
+}
+
+/******************************************************************************
+ * @brief          Sets the counter of an eventfd to 1 if ready, to 0 if not,
+ *                 only when the readiness changes.
+ * @param fd       The eventfd.
+ * @param is_ready Readiness the counter currently stands for.
+ * @param ready    New readiness.
+******************************************************************************/
+static void SetReady(int fd, int *is_ready, int ready)
+{
+	eventfd_t value = 1;
+
+	if(*is_ready == ready)
+	{
+		return;
+	}
+
+	/* Reading takes the counter back to 0 */
+	if(ready)
+	{
+		eventfd_write(fd, value);
+	}
+	else
+	{
+		eventfd_read(fd, &value);
+	}
+
+	*is_ready = ready;
+}
+
+/******************************************************************************
+ * @brief    Waits until an eventfd is readable. Waking up does not mean the
+ *           channel is still ready, the caller must try again.
+ * @param fd The eventfd.
+******************************************************************************/
+static void WaitReady(int fd)
+{
+	struct pollfd ready;
+
+	ready.fd = fd;
+	ready.events = POLLIN;
+	ready.revents = 0;
+
+	/* An interrupted wait is retried by the caller as a spurious wakeup */
+	poll(&ready, 1, -1);
+}
+/*****************************************************************************/
@@ -0,0 +1,295 @@
+/******************************************************************************
+ * @date:        18.10.2026
+
+ * @description: This implementation of the bulk loader maps or reads the whole
+ *               input once and builds the list with nodes pointing into it, so
+ *               records are never copied.
+ *
+******************************************************************************/
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdlib.h>     /* malloc, realloc, free */
+#include <string.h>     /* memchr                */
+#include <assert.h>     /* assert    :)          */
+#include <errno.h>      /* errno, EINTR          */
+#include <unistd.h>     /* read, lseek           */
+#include <sys/stat.h>   /* fstat, S_ISREG        */
+#include <sys/mman.h>   /* mmap, munmap          */
+
+#include "dll_load.h"   /* Internal use */
+/*****************************************************************************/
+#define READ_CHUNK_SIZE (1 << 20)
+#define BATCH_SIZE (256)
+#define PREFIX_SIZE (4)
+
+struct dll_load
+{
+	dll_t *dll;
+	dll_load_format_t format;
+	void *buffer;
+	size_t buffer_size;
+	int is_mapped;
+	const unsigned char *begin;
+	const unsigned char *end;
+};
+
+static int MapFile(dll_load_t *load, int fd, size_t file_size);
+static int ReadAll(dll_load_t *load, int fd);
+static int ParseRecords(dll_load_t *load);
+static size_t ReadU32(const unsigned char *buffer);
+/******************************************************************************
+ * @brief        Loads every record of a file descriptor into a new list.
+ * @param fd     File descriptor, read until end of file. It is not closed.
+ * @param format Format of the records.
+ * @return       Pointer to the loader, or NULL on failure.
+******************************************************************************/
+dll_load_t *DLLLoadFd(int fd, dll_load_format_t format)
+{
+	dll_load_t *load = (dll_load_t *)malloc(sizeof(dll_load_t));
+	struct stat status;
+	int result = -1;
+
+	assert(0 <= fd && "File descriptor isn't valid.");
+
+	if(NULL == load)
+	{
+		return (NULL);
+	}
+
+	load->dll = DLLCreate();
+	load->format = format;
+	load->buffer = NULL;
+	load->buffer_size = 0;
+	load->is_mapped = 0;
+	load->begin = NULL;
+	load->end = NULL;
+
+	if(NULL == load->dll || fstat(fd, &status))
+	{
+		DLLLoadDestroy(load);
+		return (NULL);
+	}
+
+	if(S_ISREG(status.st_mode))
+	{
+		result = MapFile(load, fd, (size_t)status.st_size);
+	}
+	else
+	{
+		result = ReadAll(load, fd);
+	}
+
+	if(result || ParseRecords(load))
+	{
+		DLLLoadDestroy(load);
+		return (NULL);
+	}
+
+	return (load);
+}
+
+/******************************************************************************
+ * @brief      Destroys a loader, its list and its buffer.
+ * @param load Pointer to the loader.
+******************************************************************************/
+void DLLLoadDestroy(dll_load_t *load)
+{
+	assert(load && "Loader isn't valid. Can not be freed.");
+
+	if(load->dll)
+	{
+		DLLDestroy(load->dll);
+	}
+
+	if(load->is_mapped)
+	{
+		munmap(load->buffer, load->buffer_size);
+	}
+	else
+	{
+		free(load->buffer);
+	}
+
+	free(load);
+}
+
+/******************************************************************************
+ * @brief      Returns the list built by a loader.
+ * @param load Pointer to the loader.
+ * @return     Pointer to the list.
+******************************************************************************/
+dll_t *DLLLoadList(const dll_load_t *load)
+{
+	assert(load && "Loader isn't valid.");
+	return (load->dll);
+}
+
+/******************************************************************************
+ * @brief        Returns the size of a record loaded by a loader.
+ * @param load   Pointer to the loader.
+ * @param record Data of a node of the loader's list.
+ * @return       Size of the record in bytes, without separator or prefix.
+******************************************************************************/
+size_t DLLLoadRecordSize(const dll_load_t *load, const void *record)
+{
+	const unsigned char *start = (const unsigned char *)record;
+	const unsigned char *separator = NULL;
+
+	assert(load && "Loader isn't valid.");
+	assert(start >= load->begin && start <= load->end && "Record isn't valid.");
+
+	if(DLL_LOAD_LENGTH_PREFIXED == load->format)
+	{
+		return (ReadU32(start - PREFIX_SIZE));
+	}
+
+	separator = (const unsigned char *)memchr(start, '\n', (size_t)(load->end - start));
+	return ((size_t)((separator ? separator : load->end) - start));
+}
+
+/******************************************************************************
+ * @brief           Maps a regular file from its current offset to its end.
+ * @param load      Pointer to the loader.
+ * @param fd        File descriptor of the file.
+ * @param file_size Size of the file in bytes.
+ * @return          0 on success, -1 on failure.
+******************************************************************************/
+static int MapFile(dll_load_t *load, int fd, size_t file_size)
+{
+	off_t offset = lseek(fd, 0, SEEK_CUR);
+	void *map = NULL;
+
+	if(0 > offset || (size_t)offset > file_size)
+	{
+		return (-1);
+	}
+
+	if((size_t)offset == file_size)
+	{
+		return (0);
+	}
+
+	map = mmap(NULL, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if(MAP_FAILED == map)
+	{
+		return (-1);
+	}
+
+	posix_madvise(map, file_size, POSIX_MADV_SEQUENTIAL);
+
+	load->buffer = map;
+	load->buffer_size = file_size;
+	load->is_mapped = 1;
+	load->begin = (const unsigned char *)map + offset;
+	load->end = (const unsigned char *)map + file_size;
+
+	/* Consuming the input as reading it would have */
+	lseek(fd, 0, SEEK_END);
+
+	return (0);
+}
+
+/******************************************************************************
+ * @brief      Reads a descriptor until end of file in large chunks.
+ * @param load Pointer to the loader.
+ * @param fd   File descriptor.
+ * @return     0 on success, -1 on failure.
+******************************************************************************/
+static int ReadAll(dll_load_t *load, int fd)
+{
+	unsigned char *buffer = NULL;
+	size_t capacity = 0;
+	size_t size = 0;
+	ssize_t bytes = 0;
+
+	do
+	{
+		if(size == capacity)
+		{
+			capacity = capacity ? capacity * 2 : READ_CHUNK_SIZE;
+			buffer = (unsigned char *)realloc(load->buffer, capacity);
+			if(NULL == buffer)
+			{
+				return (-1);
+			}
+
+			load->buffer = buffer;
+		}
+
+		bytes = read(fd, buffer + size, capacity - size);
+		if(0 < bytes)
+		{
+			size += (size_t)bytes;
+		}
+	}
+	while(0 != bytes && (0 < bytes || EINTR == errno));
+
+	load->buffer_size = size;
+	load->begin = buffer;
+	load->end = buffer + size;
+
+	return ((0 == bytes) ? 0 : -1);
+}
+
+/******************************************************************************
+ * @brief      Splits the buffer of a loader into records and pushes them to
+ *             the back of its list in batches.
+ * @param load Pointer to the loader.
+ * @return     0 on success, -1 if the input is malformed or on failure.
+******************************************************************************/
+static int ParseRecords(dll_load_t *load)
+{
+	void *batch[BATCH_SIZE];
+	const unsigned char *runner = load->begin;
+	const unsigned char *next = NULL;
+	size_t count = 0;
+	size_t size = 0;
+
+	while(runner < load->end)
+	{
+		if(DLL_LOAD_LENGTH_PREFIXED == load->format)
+		{
+			if(PREFIX_SIZE > load->end - runner)
+			{
+				return (-1);
+			}
+
+			size = ReadU32(runner);
+			runner += PREFIX_SIZE;
+			if(size > (size_t)(load->end - runner))
+			{
+				return (-1);
+			}
+
+			next = runner + size;
+		}
+		else
+		{
+			next = (const unsigned char *)memchr(runner, '\n', (size_t)(load->end - runner));
+			next = next ? next + 1 : load->end;
+		}
+
+		batch[count++] = (void *)runner;
+		runner = next;
+
+		if(BATCH_SIZE == count || runner >= load->end)
+		{
+			if(DLLPushBackMany(load->dll, batch, count) == DLLEnd(load->dll))
+			{
+				return (-1);
+			}
+
+			count = 0;
+		}
+	}
+
+	return (0);
+}
+
+/*****************************************************************************/
+static size_t ReadU32(const unsigned char *buffer)
+{
+	return ((size_t)buffer[0] | ((size_t)buffer[1] << 8) |
+	        ((size_t)buffer[2] << 16) | ((size_t)buffer[3] << 24));
+}
+/*****************************************************************************/
@@ -0,0 +1,579 @@
+/******************************************************************************
+ * @date:        18.10.2026
+
+ * @description: This implementation provides binary serialization of the doubly
+ *               linked list and read-only memory-mapped snapshots of the
+ *               serialized file, iterated in place through offset links.
+ *
+******************************************************************************/
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>      /* FILE, fopen, fwrite, fseek, fclose, rename */
+#include <stdlib.h>     /* malloc, realloc, free                      */
+#include <string.h>     /* memcmp, memcpy, strlen, strcpy, strcat     */
+#include <assert.h>     /* assert    :)                               */
+#include <fcntl.h>      /* open                                       */
+#include <unistd.h>     /* close, fsync                               */
+#include <sys/stat.h>   /* fstat                                      */
+#include <sys/mman.h>   /* mmap, munmap                               */
+
+#include "dll_serialize.h" /* Internal use              */
+#include "dll_inline.h"    /* Inline iteration of lists */
+/*****************************************************************************/
+#define MAGIC ("DLLS")
+#define MAGIC_SIZE (4)
+#define HEADER_SIZE (32)
+#define RECORD_SIZE (24)
+#define ALIGNMENT (8)
+#define ENCODE_BUFFER_SIZE (256)
+#define WRITE_BUFFER_SIZE (1 << 20)
+#define ADLER_BASE (65521UL)
+#define ADLER_NMAX (5552)
+#define TEMP_SUFFIX (".tmp")
+
+#define ENCODE_ERROR ((size_t)-1)
+#define PAD(size) (((size) + ALIGNMENT - 1) & ~(size_t)(ALIGNMENT - 1))
+
+struct dll_snapshot
+{
+	const unsigned char *base;
+	size_t size;
+	size_t count;
+	size_t end;
+};
+
+static void WriteU32(unsigned char *buffer, unsigned long value);
+static void WriteU64(unsigned char *buffer, size_t value);
+static unsigned long ReadU32(const unsigned char *buffer);
+static size_t ReadU64(const unsigned char *buffer);
+static unsigned long Adler32(unsigned long adler, const unsigned char *buffer, size_t size);
+static int WriteBlock(FILE *file, const void *block, size_t size, unsigned long *checksum);
+static int WriteRecords(FILE *file, const dll_t *dll, dll_encode_func_t encode,
+                        void *param, size_t *count, size_t *end, unsigned long *checksum);
+static int VerifySnapshot(const dll_snapshot_t *snapshot);
+static void ReleaseList(dll_t *dll, dll_release_func_t release, void *param);
+/******************************************************************************
+ * @brief        Writes a list into a file.
+ * @param dll    Pointer to the list.
+ * @param path   Path of the file, created or replaced once fully written.
+ * @param encode Payload encoding function.
+ * @param param  Parameter to be passed to the encoding function.
+ * @return       0 on success, -1 on failure.
+******************************************************************************/
+int DLLSerialize(const dll_t *dll, const char *path, dll_encode_func_t encode, void *param)
+{
+	unsigned char header[HEADER_SIZE] = {0};
+	unsigned long checksum = 1;
+	size_t count = 0;
+	size_t end = 0;
+	FILE *file = NULL;
+	char *temp_path = NULL;
+	int status = -1;
+
+	assert(dll && "dll isn't valid.");
+	assert(path && "Path isn't valid.");
+	assert(encode && "Encoding function isn't valid.");
+
+	/* Snapshots map the file, so it is never truncated in place: the list is
+	 * written next to it and renamed over it, and the old file stays intact
+	 * until then, or for good if writing fails */
+	temp_path = (char *)malloc(strlen(path) + sizeof(TEMP_SUFFIX));
+	if(NULL == temp_path)
+	{
+		return (-1);
+	}
+
+	strcpy(temp_path, path);
+	strcat(temp_path, TEMP_SUFFIX);
+
+	file = fopen(temp_path, "wb");
+	if(NULL == file)
+	{
+		free(temp_path);
+		return (-1);
+	}
+
+	setvbuf(file, NULL, _IOFBF, WRITE_BUFFER_SIZE);
+
+	/* Header is rewritten once the count and checksum are known */
+	if(1 == fwrite(header, HEADER_SIZE, 1, file) &&
+	   0 == WriteRecords(file, dll, encode, param, &count, &end, &checksum))
+	{
+		memcpy(header, MAGIC, MAGIC_SIZE);
+		WriteU32(header + 4, DLL_SERIALIZE_VERSION);
+		WriteU64(header + 8, count);
+		WriteU64(header + 16, end);
+		WriteU32(header + 24, checksum);
+		WriteU32(header + 28, 0);
+
+		if(0 == fseek(file, 0, SEEK_SET) && 1 == fwrite(header, HEADER_SIZE, 1, file) &&
+		   0 == fflush(file) && 0 == fsync(fileno(file)))
+		{
+			status = 0;
+		}
+	}
+
+	if(fclose(file) || (0 == status && rename(temp_path, path)))
+	{
+		status = -1;
+	}
+
+	if(status)
+	{
+		remove(temp_path);
+	}
+
+	free(temp_path);
+
+	return (status);
+}
+
+/******************************************************************************
+ * @brief         Rebuilds a list from a file written by DLLSerialize.
+ * @param path    Path of the file.
+ * @param decode  Payload decoding function.
+ * @param release Function releasing the data already decoded on failure, or
+ *                NULL.
+ * @param param   Parameter to be passed to the decoding and release functions.
+ * @return        Pointer to the new list, or NULL on failure.
+******************************************************************************/
+dll_t *DLLDeserialize(const char *path, dll_decode_func_t decode,
+                      dll_release_func_t release, void *param)
+{
+	dll_snapshot_t *snapshot = NULL;
+	dll_snap_iter_t runner = NULL;
+	dll_t *dll = NULL;
+	const void *buffer = NULL;
+	void *data = NULL;
+	size_t size = 0;
+
+	assert(path && "Path isn't valid.");
+	assert(decode && "Decoding function isn't valid.");
+
+	snapshot = DLLSnapshotOpen(path, 1);
+	if(NULL == snapshot)
+	{
+		return (NULL);
+	}
+
+	dll = DLLCreate();
+	if(NULL == dll)
+	{
+		DLLSnapshotClose(snapshot);
+		return (NULL);
+	}
+
+	for(runner = DLLSnapshotBegin(snapshot); runner != DLLSnapshotEnd(snapshot);
+	    runner = DLLSnapshotNext(runner))
+	{
+		buffer = DLLSnapshotGetData(runner, &size);
+		if(decode(buffer, size, &data, param))
+		{
+			ReleaseList(dll, release, param);
+			dll = NULL;
+			break;
+		}
+
+		/* Decoded but not stored, so released on its own */
+		if(NULL == DLLInlineNext(DLLPushBack(dll, data)))
+		{
+			if(NULL != release)
+			{
+				release(data, param);
+			}
+
+			ReleaseList(dll, release, param);
+			dll = NULL;
+			break;
+		}
+	}
+
+	DLLSnapshotClose(snapshot);
+	return (dll);
+}
+
+/******************************************************************************
+ * @brief        Maps a file written by DLLSerialize as a read-only snapshot.
+ * @param path   Path of the file.
+ * @param verify Non-zero to validate the checksum and every link of the file.
+ * @return       Pointer to the snapshot, or NULL if invalid or on failure.
+******************************************************************************/
+dll_snapshot_t *DLLSnapshotOpen(const char *path, int verify)
+{
+	dll_snapshot_t *snapshot = NULL;
+	const unsigned char *base = NULL;
+	struct stat status;
+	void *map = NULL;
+	int fd = -1;
+
+	assert(path && "Path isn't valid.");
+
+	fd = open(path, O_RDONLY);
+	if(-1 == fd)
+	{
+		return (NULL);
+	}
+
+	if(fstat(fd, &status) || (size_t)status.st_size < HEADER_SIZE + RECORD_SIZE)
+	{
+		close(fd);
+		return (NULL);
+	}
+
+	map = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(MAP_FAILED == map)
+	{
+		return (NULL);
+	}
+
+	snapshot = (dll_snapshot_t *)malloc(sizeof(dll_snapshot_t));
+	if(NULL == snapshot)
+	{
+		munmap(map, (size_t)status.st_size);
+		return (NULL);
+	}
+
+	base = (const unsigned char *)map;
+	snapshot->base = base;
+	snapshot->size = (size_t)status.st_size;
+	snapshot->count = ReadU64(base + 8);
+	snapshot->end = ReadU64(base + 16);
+
+	if(memcmp(base, MAGIC, MAGIC_SIZE) || DLL_SERIALIZE_VERSION != ReadU32(base + 4) ||
+	   snapshot->end < HEADER_SIZE || snapshot->end % ALIGNMENT ||
+	   snapshot->end != snapshot->size - RECORD_SIZE ||
+	   0 != ReadU64(base + snapshot->end) || 0 != ReadU64(base + snapshot->end + 16) ||
+	   (verify && VerifySnapshot(snapshot)))
+	{
+		DLLSnapshotClose(snapshot);
+		return (NULL);
+	}
+
+	return (snapshot);
+}
+
+/******************************************************************************
+ * @brief          Unmaps a snapshot. Its iterators become invalid.
+ * @param snapshot Pointer to the snapshot.
+******************************************************************************/
+void DLLSnapshotClose(dll_snapshot_t *snapshot)
+{
+	assert(snapshot && "Snapshot isn't valid. Can not be closed.");
+
+	munmap((void *)snapshot->base, snapshot->size);
+	free(snapshot);
+}
+
+/******************************************************************************
+ * @brief          Returns the number of records of a snapshot.
+ * @param snapshot Pointer to the snapshot.
+ * @return         Number of records.
+******************************************************************************/
+size_t DLLSnapshotCount(const dll_snapshot_t *snapshot)
+{
+	assert(snapshot && "Snapshot isn't valid.");
+	return (snapshot->count);
+}
+
+/******************************************************************************
+ * @brief          Returns an iterator pointing to the first record.
+ * @param snapshot Pointer to the snapshot.
+ * @return         Iterator pointing to the start of the snapshot.
+******************************************************************************/
+dll_snap_iter_t DLLSnapshotBegin(const dll_snapshot_t *snapshot)
+{
+	assert(snapshot && "Snapshot isn't valid.");
+	return ((dll_snap_iter_t)(snapshot->base + HEADER_SIZE));
+}
+
+/******************************************************************************
+ * @brief          Returns an iterator pointing to the end of the snapshot.
+ * @param snapshot Pointer to the snapshot.
+ * @return         Iterator pointing to the end of the snapshot.
+******************************************************************************/
+dll_snap_iter_t DLLSnapshotEnd(const dll_snapshot_t *snapshot)
+{
+	assert(snapshot && "Snapshot isn't valid.");
+	return ((dll_snap_iter_t)(snapshot->base + snapshot->end));
+}
+
+/******************************************************************************
+ * @brief          Returns the next iterator.
+ * @param iterator Iterator.
+ * @return         Next iterator, or NULL after the end.
+******************************************************************************/
+dll_snap_iter_t DLLSnapshotNext(dll_snap_iter_t iterator)
+{
+	const unsigned char *record = (const unsigned char *)iterator;
+	size_t next = 0;
+
+	assert(iterator && "Iterator isn't valid.");
+
+	next = ReadU64(record);
+	return (next ? (dll_snap_iter_t)(record + next) : NULL);
+}
+
+/******************************************************************************
+ * @brief          Returns the previous iterator.
+ * @param iterator Iterator.
+ * @return         Previous iterator, or NULL before the start.
+******************************************************************************/
+dll_snap_iter_t DLLSnapshotPrev(dll_snap_iter_t iterator)
+{
+	const unsigned char *record = (const unsigned char *)iterator;
+	size_t prev = 0;
+
+	assert(iterator && "Iterator isn't valid.");
+
+	prev = ReadU64(record + 8);
+	return (prev ? (dll_snap_iter_t)(record - prev) : NULL);
+}
+
+/******************************************************************************
+ * @brief          Gets the encoded payload of a record, in place.
+ * @param iterator Iterator pointing to the record.
+ * @param size     Output, size of the payload in bytes. May be NULL.
+ * @return         Pointer to the payload.
+******************************************************************************/
+const void *DLLSnapshotGetData(dll_snap_iter_t iterator, size_t *size)
+{
+	const unsigned char *record = (const unsigned char *)iterator;
+
+	assert(iterator && "Iterator isn't valid.");
+
+	if(size)
+	{
+		*size = ReadU64(record + 16);
+	}
+
+	return (record + RECORD_SIZE);
+}
+
+/******************************************************************************
+ * @brief          Writes every node of a list as a record, then the dummy
+ *                 record marking the end.
+ * @param file     File to write into, positioned after the header.
+ * @param dll      Pointer to the list.
+ * @param encode   Payload encoding function.
+ * @param param    Parameter to be passed to the encoding function.
+ * @param count    Output, number of records written.
+ * @param end      Output, offset of the dummy record.
+ * @param checksum Running Adler-32 checksum.
+ * @return         0 on success, -1 on failure.
+******************************************************************************/
+static int WriteRecords(FILE *file, const dll_t *dll, dll_encode_func_t encode,
+                        void *param, size_t *count, size_t *end, unsigned long *checksum)
+{
+	static const unsigned char padding[ALIGNMENT] = {0};
+	unsigned char record[RECORD_SIZE] = {0};
+	size_t capacity = ENCODE_BUFFER_SIZE;
+	size_t offset = HEADER_SIZE;
+	size_t prev = 0;
+	size_t size = 0;
+	unsigned char *buffer = (unsigned char *)malloc(capacity);
+	unsigned char *grown = NULL;
+	dll_iter_t runner = NULL;
+
+	if(NULL == buffer)
+	{
+		return (-1);
+	}
+
+	for(runner = DLLInlineBegin(dll); runner != DLLInlineEnd(dll); runner = DLLInlineNext(runner))
+	{
+		size = encode(DLLInlineGetData(runner), buffer, capacity, param);
+		if(ENCODE_ERROR != size && size > capacity)
+		{
+			capacity = (size > capacity * 2) ? size : capacity * 2;
+			grown = (unsigned char *)realloc(buffer, capacity);
+			if(NULL == grown)
+			{
+				break;
+			}
+
+			buffer = grown;
+			size = encode(DLLInlineGetData(runner), buffer, capacity, param);
+		}
+
+		WriteU64(record, RECORD_SIZE + PAD(size));
+		WriteU64(record + 8, prev);
+		WriteU64(record + 16, size);
+
+		if(ENCODE_ERROR == size || size > capacity ||
+		   WriteBlock(file, record, RECORD_SIZE, checksum) ||
+		   WriteBlock(file, buffer, size, checksum) ||
+		   WriteBlock(file, padding, PAD(size) - size, checksum))
+		{
+			break;
+		}
+
+		prev = RECORD_SIZE + PAD(size);
+		offset += prev;
+		++*count;
+	}
+
+	free(buffer);
+
+	if(runner != DLLInlineEnd(dll))
+	{
+		return (-1);
+	}
+
+	WriteU64(record, 0);
+	WriteU64(record + 8, prev);
+	WriteU64(record + 16, 0);
+	*end = offset;
+
+	return (WriteBlock(file, record, RECORD_SIZE, checksum));
+}
+
+/******************************************************************************
+ * @brief          Validates the checksum and the links of a snapshot.
+ * @param snapshot Pointer to the snapshot, with a valid header.
+ * @return         0 if valid, -1 if not.
+ * Complexity      Time complexity: O(n), Space complexity: O(1).
+******************************************************************************/
+static int VerifySnapshot(const dll_snapshot_t *snapshot)
+{
+	const unsigned char *base = snapshot->base;
+	size_t offset = HEADER_SIZE;
+	size_t count = 0;
+	size_t prev = 0;
+	size_t next = 0;
+	size_t size = 0;
+
+	if(ReadU32(base + 24) != Adler32(1, base + HEADER_SIZE, snapshot->size - HEADER_SIZE))
+	{
+		return (-1);
+	}
+
+	while(offset != snapshot->end)
+	{
+		next = ReadU64(base + offset);
+		size = ReadU64(base + offset + 16);
+
+		if(prev != ReadU64(base + offset + 8) || size > snapshot->end ||
+		   next != RECORD_SIZE + PAD(size) || next > snapshot->end - offset)
+		{
+			return (-1);
+		}
+
+		prev = next;
+		offset += next;
+		++count;
+	}
+
+	return ((prev == ReadU64(base + offset + 8) && count == snapshot->count) ? 0 : -1);
+}
+
+/******************************************************************************
+ * @brief          Writes a block into a file and updates the running checksum.
+ * @param file     File to write into.
+ * @param block    Block to write.
+ * @param size     Size of the block in bytes.
+ * @param checksum Running Adler-32 checksum.
+ * @return         0 on success, -1 on failure.
+******************************************************************************/
+static int WriteBlock(FILE *file, const void *block, size_t size, unsigned long *checksum)
+{
+	if(0 == size)
+	{
+		return (0);
+	}
+
+	*checksum = Adler32(*checksum, (const unsigned char *)block, size);
+	return ((1 == fwrite(block, size, 1, file)) ? 0 : -1);
+}
+
+/******************************************************************************
+ * @brief        Updates an Adler-32 checksum.
+ * @param adler  Running checksum, 1 for an empty input.
+ * @param buffer Bytes to add.
+ * @param size   Number of bytes.
+ * @return       Updated checksum.
+******************************************************************************/
+static unsigned long Adler32(unsigned long adler, const unsigned char *buffer, size_t size)
+{
+	unsigned long low = adler & 0xFFFFUL;
+	unsigned long high = (adler >> 16) & 0xFFFFUL;
+	size_t block = 0;
+
+	while(size)
+	{
+		/* Largest block for which the sums can not overflow 32 bits */
+		block = (size < ADLER_NMAX) ? size : ADLER_NMAX;
+		size -= block;
+
+		while(block--)
+		{
+			low += *buffer++;
+			high += low;
+		}
+
+		low %= ADLER_BASE;
+		high %= ADLER_BASE;
+	}
+
+	return ((high << 16) | low);
+}
+
+/*****************************************************************************/
+static void WriteU32(unsigned char *buffer, unsigned long value)
+{
+	size_t i = 0;
+
+	for(; i < 4; ++i, value >>= 8)
+	{
+		buffer[i] = (unsigned char)(value & 0xFF);
+	}
+}
+
+/*****************************************************************************/
+static void WriteU64(unsigned char *buffer, size_t value)
+{
+	size_t i = 0;
+
+	for(; i < 8; ++i, value >>= 8)
+	{
+		buffer[i] = (unsigned char)(value & 0xFF);
+	}
+}
+
+/*****************************************************************************/
+static unsigned long ReadU32(const unsigned char *buffer)
+{
+	return ((unsigned long)buffer[0] | ((unsigned long)buffer[1] << 8) |
+	        ((unsigned long)buffer[2] << 16) | ((unsigned long)buffer[3] << 24));
+}
+
+/*****************************************************************************/
+static size_t ReadU64(const unsigned char *buffer)
+{
+	size_t value = 0;
+	size_t i = 8;
+
+	while(i--)
+	{
+		value = (value << 8) | buffer[i];
+	}
+
+	return (value);
+}
+
+/******************************************************************************
+ * @brief         Releases the data of a list, then destroys it.
+ * @param dll     Pointer to the list.
+ * @param release Function releasing each data, or NULL.
+ * @param param   Parameter to be passed to the release function.
+******************************************************************************/
+static void ReleaseList(dll_t *dll, dll_release_func_t release, void *param)
+{
+	while(NULL != release && !DLLIsEmpty(dll))
+	{
+		release(DLLPopFront(dll), param);
+	}
+
+	DLLDestroy(dll);
+}
+/*****************************************************************************/
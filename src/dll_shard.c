@@ -0,0 +1,336 @@
+/******************************************************************************
+ * @date:        18.10.2026
+
+ * @description: This implementation of the sharded pool keeps, in each shard, a
+ *               list of the data and a list of spare nodes. Pushing and popping
+ *               move a node between the two with DLLSplice, so the nodes of a
+ *               shard are only allocated when its cache is empty and only freed
+ *               when its cache is full. Shards are padded apart, so that
+ *               threads locking two shards never share a cache line.
+ *
+******************************************************************************/
+#include <stdlib.h>      /* malloc, free         */
+#include <assert.h>      /* assert    :)         */
+#include <pthread.h>     /* pthread_mutex_t      */
+
+#include "dll_shard.h"    /* Internal use     */
+#include "dll_compiler.h" /* DLL_THREAD_LOCAL */
+/*****************************************************************************/
+#define CACHE_LINE (64)
+
+typedef struct shard
+{
+	pthread_mutex_t lock;
+	dll_t *list;
+	dll_t *cache;
+	size_t count;
+	size_t cached;
+
+} shard_t;
+
+/* A line of padding after each shard keeps any two shards off a common line */
+typedef union shard_slot
+{
+	shard_t shard;
+	char padding[sizeof(shard_t) + CACHE_LINE];
+
+} shard_slot_t;
+
+struct dll_shard
+{
+	shard_slot_t *slots;
+	size_t shards;
+	size_t cache_max;
+};
+
+/* The shard of a thread is index + 1, 0 until it is given one */
+static DLL_THREAD_LOCAL size_t thread_shard = 0;
+static size_t next_shard = 0;
+static pthread_mutex_t next_shard_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static shard_t *ThreadShard(dll_shard_t *pool);
+static void *ShardPop(dll_shard_t *pool, shard_t *shard, dll_iter_t iter);
+/******************************************************************************
+ * @brief           Creates a new sharded pool.
+ * @param shards    Number of shards, at least 1.
+ * @param cache_max Maximum number of spare nodes kept by each shard.
+ * @return          Pointer to the created pool, or NULL if creation fails.
+******************************************************************************/
+dll_shard_t *DLLShardCreate(size_t shards, size_t cache_max)
+{
+	dll_shard_t *pool = NULL;
+	size_t i = 0;
+
+	assert(0 < shards && "Number of shards isn't valid.");
+
+	pool = (dll_shard_t *)malloc(sizeof(dll_shard_t));
+	if(NULL == pool)
+	{
+		return (NULL);
+	}
+
+	pool->slots = (shard_slot_t *)malloc(shards * sizeof(shard_slot_t));
+	if(NULL == pool->slots)
+	{
+		free(pool);
+		return (NULL);
+	}
+
+	pool->shards = shards;
+	pool->cache_max = cache_max;
+
+	for(; i < shards; ++i)
+	{
+		shard_t *shard = &pool->slots[i].shard;
+
+		shard->list = DLLCreate();
+		shard->cache = DLLCreate();
+		shard->count = 0;
+		shard->cached = 0;
+
+		if(NULL == shard->list || NULL == shard->cache ||
+		   0 != pthread_mutex_init(&shard->lock, NULL))
+		{
+			if(NULL != shard->list)
+			{
+				DLLDestroy(shard->list);
+			}
+
+			if(NULL != shard->cache)
+			{
+				DLLDestroy(shard->cache);
+			}
+
+			pool->shards = i;
+			DLLShardDestroy(pool);
+			return (NULL);
+		}
+	}
+
+	return (pool);
+}
+
+/******************************************************************************
+ * @brief      Destroys a sharded pool, its shards and their caches.
+ * @param pool Pointer to the pool to be destroyed.
+******************************************************************************/
+void DLLShardDestroy(dll_shard_t *pool)
+{
+	size_t i = 0;
+
+	assert(pool && "Pool isn't valid. Can not be freed.");
+
+	for(; i < pool->shards; ++i)
+	{
+		shard_t *shard = &pool->slots[i].shard;
+
+		DLLDestroy(shard->list);
+		DLLDestroy(shard->cache);
+		pthread_mutex_destroy(&shard->lock);
+	}
+
+	free(pool->slots);
+	free(pool);
+}
+
+/******************************************************************************
+ * @brief       Binds the calling thread to a shard of every pool.
+ * @param index Index of the shard, e.g. the NUMA node of the thread.
+******************************************************************************/
+void DLLShardBindThread(size_t index)
+{
+	thread_shard = index + 1;
+}
+
+/******************************************************************************
+ * @brief      Pushes data to the shard of the calling thread.
+ * @param pool Pointer to the pool.
+ * @param data Pointer to the data to be pushed, not NULL.
+ * @return     0 on success, -1 if push fails.
+******************************************************************************/
+int DLLShardPush(dll_shard_t *pool, void *data)
+{
+	shard_t *shard = NULL;
+	int status = 0;
+
+	assert(pool && "Pool isn't valid.");
+	assert(data && "Data isn't valid.");
+
+	shard = ThreadShard(pool);
+	pthread_mutex_lock(&shard->lock);
+
+	if(0 < shard->cached)
+	{
+		dll_iter_t spare = DLLBegin(shard->cache);
+
+		DLLSplice(DLLEnd(shard->list), spare, DLLNext(spare));
+		DLLSetData(DLLPrev(DLLEnd(shard->list)), data);
+		--shard->cached;
+		++shard->count;
+	}
+	else
+	{
+		/* The cache is empty, so the node is allocated, which may fail */
+		dll_iter_t pushed = DLLPushBack(shard->list, data);
+
+		if(DLLIterIsEqual(pushed, DLLEnd(shard->list)))
+		{
+			status = -1;
+		}
+		else
+		{
+			++shard->count;
+		}
+	}
+
+	pthread_mutex_unlock(&shard->lock);
+
+	return (status);
+}
+
+/******************************************************************************
+ * @brief      Pops the data pushed last to the shard of the calling thread,
+ *             or if it is empty, the data pushed first to another shard.
+ * @param pool Pointer to the pool.
+ * @return     Pointer to the popped data, or NULL if every shard is empty.
+******************************************************************************/
+void *DLLShardPop(dll_shard_t *pool)
+{
+	shard_t *local = NULL;
+	size_t first = 0;
+	size_t i = 1;
+	void *data = NULL;
+
+	assert(pool && "Pool isn't valid.");
+
+	local = ThreadShard(pool);
+	pthread_mutex_lock(&local->lock);
+	if(0 < local->count)
+	{
+		data = ShardPop(pool, local, DLLPrev(DLLEnd(local->list)));
+	}
+	pthread_mutex_unlock(&local->lock);
+
+	/* Steals the oldest data, the one the owner is the least likely to touch */
+	first = (size_t)((shard_slot_t *)local - pool->slots);
+	for(; NULL == data && i < pool->shards; ++i)
+	{
+		shard_t *victim = &pool->slots[(first + i) % pool->shards].shard;
+
+		pthread_mutex_lock(&victim->lock);
+		if(0 < victim->count)
+		{
+			data = ShardPop(pool, victim, DLLBegin(victim->list));
+		}
+		pthread_mutex_unlock(&victim->lock);
+	}
+
+	return (data);
+}
+
+/******************************************************************************
+ * @brief      Counts the number of elements in all the shards.
+ * @param pool Pointer to the pool.
+ * @return     Number of elements, as seen by visiting each shard in turn.
+******************************************************************************/
+size_t DLLShardCount(dll_shard_t *pool)
+{
+	size_t count = 0;
+	size_t i = 0;
+
+	assert(pool && "Pool isn't valid.");
+
+	for(; i < pool->shards; ++i)
+	{
+		shard_t *shard = &pool->slots[i].shard;
+
+		pthread_mutex_lock(&shard->lock);
+		count += shard->count;
+		pthread_mutex_unlock(&shard->lock);
+	}
+
+	return (count);
+}
+
+/******************************************************************************
+ * @brief      Checks if all the shards are empty.
+ * @param pool Pointer to the pool.
+ * @return     1 if empty, 0 if not.
+******************************************************************************/
+int DLLShardIsEmpty(dll_shard_t *pool)
+{
+	return (0 == DLLShardCount(pool));
+}
+
+/******************************************************************************
+ * @brief       Performs an action on each data of all the shards, shard after
+ *              shard, holding the lock of the shard visited.
+ * @param pool  Pointer to the pool.
+ * @param act   Action function, given a pointer to the stored data.
+ * @param param Parameter to be passed to the action function.
+ * @return      0 on success, or the status returned by the action function.
+******************************************************************************/
+int DLLShardForEach(dll_shard_t *pool, dll_act_func_t act, void *param)
+{
+	int status = 0;
+	size_t i = 0;
+
+	assert(pool && "Pool isn't valid.");
+	assert(act && "Action function isn't valid.");
+
+	for(; 0 == status && i < pool->shards; ++i)
+	{
+		shard_t *shard = &pool->slots[i].shard;
+
+		pthread_mutex_lock(&shard->lock);
+		status = DLLForEach(DLLBegin(shard->list), DLLEnd(shard->list), act, param);
+		pthread_mutex_unlock(&shard->lock);
+	}
+
+	return (status);
+}
+
+/******************************************************************************
+ * @brief      Gets the shard of the calling thread, giving it one if needed.
+ * @param pool Pointer to the pool.
+ * @return     Pointer to the shard.
+******************************************************************************/
+static shard_t *ThreadShard(dll_shard_t *pool)
+{
+	if(0 == thread_shard)
+	{
+		pthread_mutex_lock(&next_shard_lock);
+		thread_shard = ++next_shard;
+		pthread_mutex_unlock(&next_shard_lock);
+	}
+
+	return (&pool->slots[(thread_shard - 1) % pool->shards].shard);
+}
+
+/******************************************************************************
+ * @brief       Pops the data of a node of a locked shard, keeping the node as
+ *              a spare if the cache of the shard has room for it.
+ * @param pool  Pointer to the pool.
+ * @param shard Pointer to the locked shard, not empty.
+ * @param iter  Iterator pointing to the node to pop.
+ * @return      Pointer to the popped data.
+******************************************************************************/
+static void *ShardPop(dll_shard_t *pool, shard_t *shard, dll_iter_t iter)
+{
+	void *data = DLLGetData(iter);
+
+	if(shard->cached < pool->cache_max)
+	{
+		DLLSplice(DLLEnd(shard->cache), iter, DLLNext(iter));
+		++shard->cached;
+	}
+	else
+	{
+		DLLRemove(iter);
+	}
+
+	--shard->count;
+
+	return (data);
+}
+/*****************************************************************************/
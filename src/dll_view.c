@@ -0,0 +1,218 @@
+/******************************************************************************
+ * @date:        18.10.2026
+
+ * @description: This implementation of the lazy views pulls data through the
+ *               chain of views one at a time. A filter directly over a range
+ *               searches it with DLLFind.
+ *
+******************************************************************************/
+#include <assert.h>      /* assert    :) */
+
+#include "dll_view.h"    /* Internal use */
+/*****************************************************************************/
+static dll_view_t *InitView(dll_view_t *view, dll_view_kind_t kind, dll_view_t *source);
+static int FilterNext(dll_view_t *view, void **data);
+/******************************************************************************
+ * @brief      Sets up a view of the data of a range.
+ * @param view Storage of the view.
+ * @param from Iterator pointing to the start of the range.
+ * @param to   Iterator pointing to the end of the range (not included).
+ * @return     Pointer to the view.
+******************************************************************************/
+dll_view_t *DLLViewRange(dll_view_t *view, dll_iter_t from, dll_iter_t to)
+{
+	assert(from && "From iterator isn't valid.");
+	assert(to && "To iterator isn't valid.");
+
+	InitView(view, DLL_VIEW_RANGE, NULL);
+	view->position = from;
+	view->to = to;
+
+	return (view);
+}
+
+/******************************************************************************
+ * @brief        Sets up a view of the data of another view that match.
+ * @param view   Storage of the view.
+ * @param source View to filter.
+ * @param cmp    Comparison function, returning 0 for the data to keep.
+ * @param param  Parameter to be passed to the comparison function.
+ * @return       Pointer to the view.
+******************************************************************************/
+dll_view_t *DLLViewFilter(dll_view_t *view, dll_view_t *source, dll_cmp_func_t cmp, void *param)
+{
+	assert(cmp && "Comparison function isn't valid.");
+
+	InitView(view, DLL_VIEW_FILTER, source);
+	view->cmp = cmp;
+	view->param = param;
+
+	return (view);
+}
+
+/******************************************************************************
+ * @brief        Sets up a view of the data of another view transformed.
+ * @param view   Storage of the view.
+ * @param source View to transform.
+ * @param map    Function returning the transformed data.
+ * @param param  Parameter to be passed to the function.
+ * @return       Pointer to the view.
+******************************************************************************/
+dll_view_t *DLLViewMap(dll_view_t *view, dll_view_t *source, dll_map_func_t map, void *param)
+{
+	assert(map && "Map function isn't valid.");
+
+	InitView(view, DLL_VIEW_MAP, source);
+	view->map = map;
+	view->param = param;
+
+	return (view);
+}
+
+/******************************************************************************
+ * @brief        Sets up a view of the first data of another view.
+ * @param view   Storage of the view.
+ * @param source View to take from.
+ * @param count  Maximum number of data.
+ * @return       Pointer to the view.
+******************************************************************************/
+dll_view_t *DLLViewTake(dll_view_t *view, dll_view_t *source, size_t count)
+{
+	InitView(view, DLL_VIEW_TAKE, source);
+	view->count = count;
+
+	return (view);
+}
+
+/******************************************************************************
+ * @brief        Sets up a view of the data of another view after its first.
+ * @param view   Storage of the view.
+ * @param source View to skip from.
+ * @param count  Number of data to skip.
+ * @return       Pointer to the view.
+******************************************************************************/
+dll_view_t *DLLViewSkip(dll_view_t *view, dll_view_t *source, size_t count)
+{
+	InitView(view, DLL_VIEW_SKIP, source);
+	view->count = count;
+
+	return (view);
+}
+
+/******************************************************************************
+ * @brief      Pulls the next data of a view.
+ * @param view Pointer to the view.
+ * @param data Set to the next data.
+ * @return     1 if a data was pulled, 0 if the view is exhausted.
+******************************************************************************/
+int DLLViewNext(dll_view_t *view, void **data)
+{
+	assert(view && "View isn't valid.");
+	assert(data && "Data isn't valid.");
+
+	switch(view->kind)
+	{
+		case DLL_VIEW_RANGE:
+			if(DLLIterIsEqual(view->position, view->to))
+			{
+				return (0);
+			}
+
+			*data = DLLGetData(view->position);
+			view->position = DLLNext(view->position);
+			return (1);
+
+		case DLL_VIEW_FILTER:
+			return (FilterNext(view, data));
+
+		case DLL_VIEW_MAP:
+			if(!DLLViewNext(view->source, data))
+			{
+				return (0);
+			}
+
+			*data = view->map(*data, view->param);
+			return (1);
+
+		case DLL_VIEW_TAKE:
+			/* Once taken, the source is not pulled any further */
+			if(0 == view->count || !DLLViewNext(view->source, data))
+			{
+				return (0);
+			}
+
+			--view->count;
+			return (1);
+
+		case DLL_VIEW_SKIP:
+			for(; 0 < view->count; --view->count)
+			{
+				if(!DLLViewNext(view->source, data))
+				{
+					return (0);
+				}
+			}
+
+			return (DLLViewNext(view->source, data));
+
+		default:
+			assert(!"View kind isn't valid.");
+			return (0);
+	}
+}
+
+/******************************************************************************
+ * @brief      Pulls the next matching data of a filter.
+ * @param view Pointer to the filter.
+ * @param data Set to the next matching data.
+ * @return     1 if a data was pulled, 0 if the source is exhausted.
+******************************************************************************/
+static int FilterNext(dll_view_t *view, void **data)
+{
+	dll_view_t *source = view->source;
+	dll_iter_t found = NULL;
+
+	if(DLL_VIEW_RANGE == source->kind)
+	{
+		found = DLLFind(source->position, source->to, view->cmp, view->param);
+		if(DLLIterIsEqual(found, source->to))
+		{
+			source->position = found;
+			return (0);
+		}
+
+		*data = DLLGetData(found);
+		source->position = DLLNext(found);
+		return (1);
+	}
+
+	while(DLLViewNext(source, data))
+	{
+		if(0 == view->cmp(*data, view->param))
+		{
+			return (1);
+		}
+	}
+
+	return (0);
+}
+
+/*****************************************************************************/
+static dll_view_t *InitView(dll_view_t *view, dll_view_kind_t kind, dll_view_t *source)
+{
+	assert(view && "View isn't valid.");
+	assert((DLL_VIEW_RANGE == kind || source) && "Source view isn't valid.");
+	assert(view != source && "View can not be its own source.");
+
+	view->kind = kind;
+	view->source = source;
+	view->position = NULL;
+	view->to = NULL;
+	view->cmp = NULL;
+	view->map = NULL;
+	view->param = NULL;
+	view->count = 0;
+
+	return (view);
+}
+/*****************************************************************************/
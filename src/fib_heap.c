@@ -0,0 +1,484 @@
+/******************************************************************************
+ * @date:        18.10.2026
+
+ * @description: This implementation of the Fibonacci heap keeps the roots in a
+ *               list and the children of every element in a list of its own,
+ *               created on insertion. Linking, cutting and melding move nodes
+ *               between these lists with DLLSplice, so they never allocate. An
+ *               element remembers the iterator of its node, and the element
+ *               that DLLRemoveGetMoved or DLLSpliceGetMoved report as moved into
+ *               another node has it updated right away.
+ *
+******************************************************************************/
+#include <stdlib.h>      /* malloc, calloc, free */
+#include <assert.h>      /* assert    :)         */
+
+#include "dll.h"         /* Internal use */
+#include "fib_heap.h"    /* Internal use */
+/*****************************************************************************/
+/* Degrees are bounded by log base 1.618 of the count, 1.44 bits per degree */
+#define MAX_DEGREE (sizeof(size_t) * 12)
+
+struct fib_handle
+{
+	void *data;
+	dll_iter_t iter;
+	fib_handle_t *parent;
+	dll_t *children;
+	size_t degree;
+	int is_marked;
+};
+
+struct fib_heap
+{
+	dll_t *roots;
+	dll_t *pending;
+	fib_handle_t *min;
+	dll_cmp_func_t cmp;
+	size_t count;
+};
+
+static void *FibHeapExtract(fib_heap_t *heap, fib_handle_t *handle);
+static void FibHeapConsolidate(fib_heap_t *heap);
+static void FibHeapCut(fib_heap_t *heap, fib_handle_t *handle);
+static void FibHeapCascadingCut(fib_heap_t *heap, fib_handle_t *handle);
+static int FibHeapIsBefore(const fib_heap_t *heap, fib_handle_t *handle, fib_handle_t *other);
+static void FibUnlink(fib_handle_t *handle);
+static void FibMove(fib_handle_t *handle, dll_t *into);
+static void FibMoveAll(dll_t *from, dll_t *into);
+static int ClearParent(void *data, void *param);
+/******************************************************************************
+ * @brief     Creates a new heap.
+ * @param cmp Comparison function, negative when its first argument comes first.
+ * @return    Pointer to the created heap, or NULL if creation fails.
+******************************************************************************/
+fib_heap_t *FibHeapCreate(dll_cmp_func_t cmp)
+{
+	fib_heap_t *heap = (fib_heap_t *)calloc(1, sizeof(fib_heap_t));
+
+	assert(cmp && "Comparison function isn't valid.");
+
+	if(NULL == heap)
+	{
+		return (NULL);
+	}
+
+	heap->roots = DLLCreate();
+	heap->pending = DLLCreate();
+	heap->cmp = cmp;
+
+	if(NULL == heap->roots || NULL == heap->pending)
+	{
+		FibHeapDestroy(heap);
+		return (NULL);
+	}
+
+	return (heap);
+}
+
+/******************************************************************************
+ * @brief      Destroys a heap. Its handles become invalid.
+ * @param heap Pointer to the heap to be destroyed.
+******************************************************************************/
+void FibHeapDestroy(fib_heap_t *heap)
+{
+	fib_handle_t *handle = NULL;
+
+	assert(heap && "Heap isn't valid. Can not be freed.");
+
+	if(heap->roots)
+	{
+		/* Children are moved up to the roots before their parent is freed */
+		while(!DLLIsEmpty(heap->roots))
+		{
+			handle = (fib_handle_t *)DLLGetData(DLLBegin(heap->roots));
+			FibMoveAll(handle->children, heap->roots);
+			FibUnlink(handle);
+			DLLDestroy(handle->children);
+			free(handle);
+		}
+
+		DLLDestroy(heap->roots);
+	}
+
+	if(heap->pending)
+	{
+		DLLDestroy(heap->pending);
+	}
+
+	free(heap);
+}
+
+/******************************************************************************
+ * @brief      Inserts data into the heap.
+ * @param heap Pointer to the heap.
+ * @param data Pointer to the data to be inserted.
+ * @return     Handle of the element, or NULL if insertion fails.
+******************************************************************************/
+fib_handle_t *FibHeapInsert(fib_heap_t *heap, void *data)
+{
+	fib_handle_t *handle = (fib_handle_t *)malloc(sizeof(fib_handle_t));
+
+	assert(heap && "Heap isn't valid.");
+
+	if(NULL == handle)
+	{
+		return (NULL);
+	}
+
+	handle->children = DLLCreate();
+	if(NULL == handle->children)
+	{
+		free(handle);
+		return (NULL);
+	}
+
+	handle->iter = DLLPushBack(heap->roots, handle);
+	if(NULL == DLLNext(handle->iter))
+	{
+		DLLDestroy(handle->children);
+		free(handle);
+		return (NULL);
+	}
+
+	handle->data = data;
+	handle->parent = NULL;
+	handle->degree = 0;
+	handle->is_marked = 0;
+
+	if(NULL == heap->min || FibHeapIsBefore(heap, handle, heap->min))
+	{
+		heap->min = handle;
+	}
+
+	++heap->count;
+	return (handle);
+}
+
+/******************************************************************************
+ * @brief      Returns the first data of the heap without removing it.
+ * @param heap Pointer to the heap, not empty.
+ * @return     Pointer to the first data.
+******************************************************************************/
+void *FibHeapPeek(const fib_heap_t *heap)
+{
+	assert(heap && "Heap isn't valid.");
+	assert(heap->min && "Heap is empty.");
+
+	return (heap->min->data);
+}
+
+/******************************************************************************
+ * @brief      Removes the first data of the heap.
+ * @param heap Pointer to the heap, not empty.
+ * @return     Pointer to the popped data.
+******************************************************************************/
+void *FibHeapPop(fib_heap_t *heap)
+{
+	assert(heap && "Heap isn't valid.");
+	assert(heap->min && "Heap is empty.");
+
+	return (FibHeapExtract(heap, heap->min));
+}
+
+/******************************************************************************
+ * @brief        Moves every element of a heap into another and destroys it.
+ * @param dest   Pointer to the heap receiving the elements.
+ * @param source Pointer to the heap to be melded, destroyed.
+******************************************************************************/
+void FibHeapMeld(fib_heap_t *dest, fib_heap_t *source)
+{
+	assert(dest && "Destination heap isn't valid.");
+	assert(source && "Source heap isn't valid.");
+	assert(dest != source && "Heap can not be melded into itself.");
+	assert(dest->cmp == source->cmp && "Heaps must share the comparison function.");
+
+	FibMoveAll(source->roots, dest->roots);
+
+	if(NULL == dest->min ||
+	   (NULL != source->min && FibHeapIsBefore(dest, source->min, dest->min)))
+	{
+		dest->min = source->min;
+	}
+
+	dest->count += source->count;
+	FibHeapDestroy(source);
+}
+
+/******************************************************************************
+ * @brief        Replaces the data of an element by data that does not come
+ *               after it.
+ * @param heap   Pointer to the heap.
+ * @param handle Handle of the element.
+ * @param data   Pointer to the new data.
+******************************************************************************/
+void FibHeapDecreaseKey(fib_heap_t *heap, fib_handle_t *handle, void *data)
+{
+	fib_handle_t *parent = NULL;
+
+	assert(heap && "Heap isn't valid.");
+	assert(handle && "Handle isn't valid.");
+	assert(0 >= heap->cmp(data, handle->data) && "New data comes after the old.");
+
+	handle->data = data;
+	parent = handle->parent;
+
+	if(NULL != parent && FibHeapIsBefore(heap, handle, parent))
+	{
+		FibHeapCut(heap, handle);
+		FibHeapCascadingCut(heap, parent);
+	}
+
+	if(FibHeapIsBefore(heap, handle, heap->min))
+	{
+		heap->min = handle;
+	}
+}
+
+/******************************************************************************
+ * @brief        Removes an element from the heap.
+ * @param heap   Pointer to the heap.
+ * @param handle Handle of the element.
+ * @return       Pointer to the removed data.
+******************************************************************************/
+void *FibHeapRemove(fib_heap_t *heap, fib_handle_t *handle)
+{
+	fib_handle_t *parent = NULL;
+
+	assert(heap && "Heap isn't valid.");
+	assert(handle && "Handle isn't valid.");
+
+	parent = handle->parent;
+	if(NULL != parent)
+	{
+		FibHeapCut(heap, handle);
+		FibHeapCascadingCut(heap, parent);
+	}
+
+	return (FibHeapExtract(heap, handle));
+}
+
+/******************************************************************************
+ * @brief        Gets the data of an element.
+ * @param handle Handle of the element.
+ * @return       Pointer to the data.
+******************************************************************************/
+void *FibHeapGetData(const fib_handle_t *handle)
+{
+	assert(handle && "Handle isn't valid.");
+	return (handle->data);
+}
+
+/******************************************************************************
+ * @brief      Counts the elements of the heap.
+ * @param heap Pointer to the heap.
+ * @return     Number of elements.
+******************************************************************************/
+size_t FibHeapSize(const fib_heap_t *heap)
+{
+	assert(heap && "Heap isn't valid.");
+	return (heap->count);
+}
+
+/******************************************************************************
+ * @brief      Checks if the heap is empty.
+ * @param heap Pointer to the heap.
+ * @return     1 if empty, 0 if not.
+******************************************************************************/
+int FibHeapIsEmpty(const fib_heap_t *heap)
+{
+	assert(heap && "Heap isn't valid.");
+	return (0 == heap->count);
+}
+
+/******************************************************************************
+ * @brief        Removes a root from the heap, moving its children to the roots.
+ * @param heap   Pointer to the heap.
+ * @param handle Root to be removed, freed.
+ * @return       Pointer to the data of the root.
+******************************************************************************/
+static void *FibHeapExtract(fib_heap_t *heap, fib_handle_t *handle)
+{
+	void *data = handle->data;
+	int was_min = (heap->min == handle);
+
+	DLLForEach(DLLBegin(handle->children), DLLEnd(handle->children), ClearParent, NULL);
+	FibMoveAll(handle->children, heap->roots);
+
+	FibUnlink(handle);
+	DLLDestroy(handle->children);
+	free(handle);
+	--heap->count;
+
+	/* Any other root still comes before the children of the removed one */
+	if(was_min)
+	{
+		FibHeapConsolidate(heap);
+	}
+
+	return (data);
+}
+
+/******************************************************************************
+ * @brief      Links the roots of equal degree until all degrees differ, and
+ *             finds the new first root.
+ * @param heap Pointer to the heap.
+******************************************************************************/
+static void FibHeapConsolidate(fib_heap_t *heap)
+{
+	fib_handle_t *degrees[MAX_DEGREE] = {NULL};
+	fib_handle_t *root = NULL;
+	fib_handle_t *other = NULL;
+	fib_handle_t *swap = NULL;
+	size_t degree = 0;
+
+	FibMoveAll(heap->roots, heap->pending);
+	heap->min = NULL;
+
+	while(!DLLIsEmpty(heap->pending))
+	{
+		root = (fib_handle_t *)DLLGetData(DLLBegin(heap->pending));
+		FibMove(root, heap->roots);
+
+		while(NULL != degrees[root->degree])
+		{
+			other = degrees[root->degree];
+			degrees[root->degree] = NULL;
+
+			if(FibHeapIsBefore(heap, other, root))
+			{
+				swap = root;
+				root = other;
+				other = swap;
+			}
+
+			FibMove(other, root->children);
+			other->parent = root;
+			other->is_marked = 0;
+			++root->degree;
+		}
+
+		assert(MAX_DEGREE > root->degree && "Degree is out of bounds.");
+		degrees[root->degree] = root;
+	}
+
+	for(degree = 0; degree < MAX_DEGREE; ++degree)
+	{
+		root = degrees[degree];
+		if(NULL != root && (NULL == heap->min || FibHeapIsBefore(heap, root, heap->min)))
+		{
+			heap->min = root;
+		}
+	}
+}
+
+/******************************************************************************
+ * @brief        Moves an element from the children of its parent to the roots.
+ * @param heap   Pointer to the heap.
+ * @param handle Element with a parent.
+******************************************************************************/
+static void FibHeapCut(fib_heap_t *heap, fib_handle_t *handle)
+{
+	FibMove(handle, heap->roots);
+	--handle->parent->degree;
+	handle->parent = NULL;
+	handle->is_marked = 0;
+}
+
+/******************************************************************************
+ * @brief        Marks an element that lost a child, or cuts it if it already
+ *               lost one, going up while elements are cut.
+ * @param heap   Pointer to the heap.
+ * @param handle Element that lost a child.
+******************************************************************************/
+static void FibHeapCascadingCut(fib_heap_t *heap, fib_handle_t *handle)
+{
+	fib_handle_t *parent = handle->parent;
+
+	while(NULL != parent)
+	{
+		if(!handle->is_marked)
+		{
+			handle->is_marked = 1;
+			return;
+		}
+
+		FibHeapCut(heap, handle);
+		handle = parent;
+		parent = handle->parent;
+	}
+}
+
+/*****************************************************************************/
+static int FibHeapIsBefore(const fib_heap_t *heap, fib_handle_t *handle, fib_handle_t *other)
+{
+	return (0 > heap->cmp(handle->data, other->data));
+}
+
+/******************************************************************************
+ * @brief        Removes an element from its list, keeping the iterator of the
+ *               element moved into its node up to date.
+ * @param handle Element in a list.
+******************************************************************************/
+static void FibUnlink(fib_handle_t *handle)
+{
+	fib_handle_t *moved = (fib_handle_t *)DLLRemoveGetMoved(handle->iter);
+
+	if(NULL != moved)
+	{
+		moved->iter = handle->iter;
+	}
+
+	handle->iter = NULL;
+}
+
+/******************************************************************************
+ * @brief        Moves the node of an element to the back of another list,
+ *               keeping the iterators of the moved elements up to date.
+ * @param handle Element in a list.
+ * @param into   List to move the element into.
+******************************************************************************/
+static void FibMove(fib_handle_t *handle, dll_t *into)
+{
+	dll_iter_t into_end = DLLEnd(into);
+	fib_handle_t *moved = (fib_handle_t *)DLLSpliceGetMoved(into_end, handle->iter,
+	                                                        DLLNext(handle->iter));
+
+	if(NULL != moved)
+	{
+		moved->iter = handle->iter;
+	}
+
+	handle->iter = into_end;
+}
+
+/******************************************************************************
+ * @brief      Moves every element of a list to the back of another in one
+ *             splice.
+ * @param from List to move the elements from, left empty.
+ * @param into List to move the elements into.
+******************************************************************************/
+static void FibMoveAll(dll_t *from, dll_t *into)
+{
+	dll_iter_t into_end = DLLEnd(into);
+	fib_handle_t *first = NULL;
+
+	if(DLLIsEmpty(from))
+	{
+		return;
+	}
+
+	/* A whole list is spliced, so only its first element changes node */
+	first = (fib_handle_t *)DLLGetData(DLLBegin(from));
+	DLLSplice(into_end, DLLBegin(from), DLLEnd(from));
+	first->iter = into_end;
+}
+
+/*****************************************************************************/
+static int ClearParent(void *data, void *param)
+{
+	(void) param;
+	((fib_handle_t *)*(void **)data)->parent = NULL;
+	return (0);
+}
+/*****************************************************************************/
@@ -0,0 +1,355 @@
+/******************************************************************************
+ * @date:        18.10.2026
+
+ * @description: This implementation of the hierarchical timer wheel keeps every
+ *               pending timer in a slot list. A timer remembers the iterator of
+ *               its node, which is all DLLRemove needs. Removing and splicing
+ *               move data between nodes, so they go through DLLRemoveGetMoved
+ *               and DLLSpliceGetMoved, and the timer whose data moved has its
+ *               iterator updated right away, keeping handles O(1).
+ *
+******************************************************************************/
+#include <stdlib.h>      /* malloc, free */
+#include <assert.h>      /* assert    :) */
+
+#include "dll.h"         /* Internal use */
+#include "timer_wheel.h" /* Internal use */
+/*****************************************************************************/
+#define LEVELS (6)
+#define LEVEL_BITS (6)
+#define LEVEL_SIZE (1 << LEVEL_BITS)
+#define LEVEL_MASK (LEVEL_SIZE - 1)
+
+/* Wraps to the largest size_t when the wheel spans more than size_t */
+#define MAX_DELAY ((((size_t)1 << (LEVEL_BITS * (LEVELS - 1))) * LEVEL_SIZE) - 1)
+
+struct wheel_timer
+{
+	dll_iter_t iter;
+	size_t expires;
+	timer_func_t func;
+	void *param;
+};
+
+struct timer_wheel
+{
+	dll_t *slots[LEVELS][LEVEL_SIZE];
+	dll_t *detached;
+	size_t now;
+	size_t count;
+};
+
+static dll_t *TimerWheelSlot(timer_wheel_t *wheel, size_t expires);
+static void TimerUnlink(wheel_timer_t *timer);
+static void TimerMove(wheel_timer_t *timer, dll_t *into);
+static void TimerWheelDetach(dll_t *slot, dll_t *into);
+static void TimerWheelCascade(timer_wheel_t *wheel, size_t tick);
+static int FreeTimer(void *data, void *param);
+/******************************************************************************
+ * @brief     Creates a new timer wheel at tick 0.
+ * @return    Pointer to the created wheel, or NULL if creation fails.
+******************************************************************************/
+timer_wheel_t *TimerWheelCreate(void)
+{
+	size_t level = 0;
+	size_t slot = 0;
+	timer_wheel_t *wheel = (timer_wheel_t *)calloc(1, sizeof(timer_wheel_t));
+
+	if(NULL == wheel)
+	{
+		return (NULL);
+	}
+
+	wheel->detached = DLLCreate();
+	if(NULL == wheel->detached)
+	{
+		free(wheel);
+		return (NULL);
+	}
+
+	for(level = 0; level < LEVELS; ++level)
+	{
+		for(slot = 0; slot < LEVEL_SIZE; ++slot)
+		{
+			wheel->slots[level][slot] = DLLCreate();
+			if(NULL == wheel->slots[level][slot])
+			{
+				TimerWheelDestroy(wheel);
+				return (NULL);
+			}
+		}
+	}
+
+	return (wheel);
+}
+
+/******************************************************************************
+ * @brief       Destroys a timer wheel. Pending timers are dropped.
+ * @param wheel Pointer to the wheel to be destroyed.
+******************************************************************************/
+void TimerWheelDestroy(timer_wheel_t *wheel)
+{
+	size_t level = 0;
+	size_t slot = 0;
+	dll_t *list = NULL;
+
+	assert(wheel && "Wheel isn't valid. Can not be freed.");
+
+	for(level = 0; level < LEVELS; ++level)
+	{
+		for(slot = 0; slot < LEVEL_SIZE; ++slot)
+		{
+			list = wheel->slots[level][slot];
+			if(list)
+			{
+				DLLForEach(DLLBegin(list), DLLEnd(list), FreeTimer, NULL);
+				DLLDestroy(list);
+			}
+		}
+	}
+
+	DLLForEach(DLLBegin(wheel->detached), DLLEnd(wheel->detached), FreeTimer, NULL);
+	DLLDestroy(wheel->detached);
+	free(wheel);
+}
+
+/******************************************************************************
+ * @brief       Schedules a function to be called after a number of ticks.
+ * @param wheel Pointer to the wheel.
+ * @param ticks Delay in ticks, 0 is treated as 1.
+ * @param func  Function called when the timer expires.
+ * @param param Parameter to be passed to the function.
+ * @return      Handle of the timer, or NULL if scheduling fails.
+******************************************************************************/
+wheel_timer_t *TimerWheelSchedule(timer_wheel_t *wheel, size_t ticks, timer_func_t func, void *param)
+{
+	wheel_timer_t *timer = (wheel_timer_t *)malloc(sizeof(wheel_timer_t));
+
+	assert(wheel && "Wheel isn't valid.");
+	assert(func && "Function isn't valid.");
+
+	if(NULL == timer)
+	{
+		return (NULL);
+	}
+
+	ticks = (0 == ticks) ? 1 : ticks;
+	ticks = (ticks > MAX_DELAY) ? MAX_DELAY : ticks;
+
+	timer->expires = wheel->now + ticks;
+	timer->func = func;
+	timer->param = param;
+
+	timer->iter = DLLPushBack(TimerWheelSlot(wheel, timer->expires), timer);
+	if(NULL == DLLNext(timer->iter))
+	{
+		free(timer);
+		return (NULL);
+	}
+
+	++wheel->count;
+	return (timer);
+}
+
+/******************************************************************************
+ * @brief       Cancels a pending timer and releases its handle.
+ * @param wheel Pointer to the wheel.
+ * @param timer Handle of a pending timer.
+******************************************************************************/
+void TimerWheelCancel(timer_wheel_t *wheel, wheel_timer_t *timer)
+{
+	assert(wheel && "Wheel isn't valid.");
+	assert(timer && "Timer isn't valid.");
+
+	/* A timer being fired is already out of the wheel and freed after it */
+	if(NULL == timer->iter)
+	{
+		return;
+	}
+
+	TimerUnlink(timer);
+	--wheel->count;
+	free(timer);
+}
+
+/******************************************************************************
+ * @brief       Moves time forward, firing every timer that expires on the way.
+ * @param wheel Pointer to the wheel.
+ * @param ticks Number of ticks to move forward.
+ * @return      Number of timers fired.
+******************************************************************************/
+size_t TimerWheelAdvance(timer_wheel_t *wheel, size_t ticks)
+{
+	size_t fired = 0;
+	size_t tick = 0;
+	wheel_timer_t *timer = NULL;
+
+	assert(wheel && "Wheel isn't valid.");
+
+	while(ticks--)
+	{
+		tick = wheel->now + 1;
+
+		/* Timers are placed relative to now + 1, cascading before moving on */
+		if(0 == (tick & LEVEL_MASK))
+		{
+			TimerWheelCascade(wheel, tick);
+		}
+
+		wheel->now = tick;
+		TimerWheelDetach(wheel->slots[0][tick & LEVEL_MASK], wheel->detached);
+
+		while(!DLLIsEmpty(wheel->detached))
+		{
+			timer = (wheel_timer_t *)DLLGetData(DLLBegin(wheel->detached));
+			TimerUnlink(timer);
+			--wheel->count;
+			++fired;
+
+			timer->func(timer->param);
+			free(timer);
+		}
+	}
+
+	return (fired);
+}
+
+/******************************************************************************
+ * @brief       Returns the current tick of the wheel.
+ * @param wheel Pointer to the wheel.
+ * @return      Number of ticks since creation.
+******************************************************************************/
+size_t TimerWheelNow(const timer_wheel_t *wheel)
+{
+	assert(wheel && "Wheel isn't valid.");
+	return (wheel->now);
+}
+
+/******************************************************************************
+ * @brief       Counts the pending timers of the wheel.
+ * @param wheel Pointer to the wheel.
+ * @return      Number of pending timers.
+******************************************************************************/
+size_t TimerWheelCount(const timer_wheel_t *wheel)
+{
+	assert(wheel && "Wheel isn't valid.");
+	return (wheel->count);
+}
+
+/******************************************************************************
+ * @brief         Returns the slot of an expiry, in the coarsest level that holds
+ *                its distance from the next tick.
+ * @param wheel   Pointer to the wheel.
+ * @param expires Tick of the expiry, after now.
+ * @return        Slot list.
+******************************************************************************/
+static dll_t *TimerWheelSlot(timer_wheel_t *wheel, size_t expires)
+{
+	size_t delta = expires - (wheel->now + 1);
+	size_t level = 0;
+
+	while(level < LEVELS - 1 && (delta >> (LEVEL_BITS * (level + 1))))
+	{
+		++level;
+	}
+
+	return (wheel->slots[level][(expires >> (LEVEL_BITS * level)) & LEVEL_MASK]);
+}
+
+/******************************************************************************
+ * @brief       Re-adds the timers of the slots reached by a tick to finer
+ *              levels, from the finest level up.
+ * @param wheel Pointer to the wheel.
+ * @param tick  Tick about to be processed, a multiple of LEVEL_SIZE.
+******************************************************************************/
+static void TimerWheelCascade(timer_wheel_t *wheel, size_t tick)
+{
+	size_t level = 1;
+	size_t index = 0;
+	wheel_timer_t *timer = NULL;
+
+	for(; level < LEVELS; ++level)
+	{
+		index = (tick >> (LEVEL_BITS * level)) & LEVEL_MASK;
+		TimerWheelDetach(wheel->slots[level][index], wheel->detached);
+
+		while(!DLLIsEmpty(wheel->detached))
+		{
+			timer = (wheel_timer_t *)DLLGetData(DLLBegin(wheel->detached));
+			TimerMove(timer, TimerWheelSlot(wheel, timer->expires));
+		}
+
+		if(index)
+		{
+			break;
+		}
+	}
+}
+
+/******************************************************************************
+ * @brief      Moves every timer of a slot to the back of another list in one
+ *             splice.
+ * @param slot Slot list, left empty.
+ * @param into List to move the timers into.
+******************************************************************************/
+static void TimerWheelDetach(dll_t *slot, dll_t *into)
+{
+	dll_iter_t into_end = DLLEnd(into);
+	wheel_timer_t *first = NULL;
+
+	if(DLLIsEmpty(slot))
+	{
+		return;
+	}
+
+	/* Only the first timer changes node, the others keep theirs */
+	first = (wheel_timer_t *)DLLGetData(DLLBegin(slot));
+	DLLSplice(into_end, DLLBegin(slot), DLLEnd(slot));
+	first->iter = into_end;
+}
+
+/******************************************************************************
+ * @brief       Removes a timer from its list, keeping the iterator of the timer
+ *              moved into its node up to date.
+ * @param timer Timer in a list.
+******************************************************************************/
+static void TimerUnlink(wheel_timer_t *timer)
+{
+	wheel_timer_t *moved = (wheel_timer_t *)DLLRemoveGetMoved(timer->iter);
+
+	if(NULL != moved)
+	{
+		moved->iter = timer->iter;
+	}
+
+	timer->iter = NULL;
+}
+
+/******************************************************************************
+ * @brief       Moves the node of a timer to the back of another list, without
+ *              allocating, keeping the iterators of the moved timers up to date.
+ * @param timer Timer in a list.
+ * @param into  List to move the timer into.
+******************************************************************************/
+static void TimerMove(wheel_timer_t *timer, dll_t *into)
+{
+	dll_iter_t into_end = DLLEnd(into);
+	wheel_timer_t *moved = (wheel_timer_t *)DLLSpliceGetMoved(into_end, timer->iter,
+	                                                          DLLNext(timer->iter));
+
+	if(NULL != moved)
+	{
+		moved->iter = timer->iter;
+	}
+
+	timer->iter = into_end;
+}
+
+/*****************************************************************************/
+static int FreeTimer(void *data, void *param)
+{
+	(void) param;
+	free(*(void **)data);
+	return (0);
+}
+/*****************************************************************************/
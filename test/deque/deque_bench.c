@@ -0,0 +1,134 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This benchmark compares the chunked deque with the doubly linked
+ *               list used as a deque, and a plain array for the scan.
+ *
+ *               Usage: deque_bench [number of elements]
+ * 
+******************************************************************************/
+#include <stdio.h>  /* printf       */
+#include <stdlib.h> /* malloc, free */
+#include <time.h>   /* clock        */
+
+#include "dll.h"    /* Internal API */
+#include "deque.h"  /* Internal API */
+/*****************************************************************************/
+#define DEFAULT_ELEMENTS (10000000UL)
+#define SECONDS(start) ((double)(clock() - (start)) / CLOCKS_PER_SEC)
+/*****************************************************************************/
+int Sum(void *data, void *param);
+void BenchDll(size_t elements);
+void BenchDeque(size_t elements);
+void BenchArray(size_t elements);
+/*****************************************************************************/
+int main(int argc, char *argv[])
+{
+	size_t elements = (1 < argc) ? strtoul(argv[1], NULL, 10) : DEFAULT_ELEMENTS;
+
+	printf("elements: %lu\n", (unsigned long)elements);
+	printf("%-8s %10s %10s %10s\n", "", "push", "scan", "pop");
+	BenchDll(elements);
+	BenchDeque(elements);
+	BenchArray(elements);
+
+	return 0;
+}
+/*****************************************************************************/
+void BenchDll(size_t elements)
+{
+	size_t i = 0;
+	size_t sum = 0;
+	dll_t *dll = DLLCreate();
+	clock_t start = clock();
+	double push = 0;
+	double scan = 0;
+
+	for(i = 0; i < elements; ++i)
+	{
+		DLLPushBack(dll, (void *)i);
+	}
+
+	push = SECONDS(start);
+	start = clock();
+	DLLForEach(DLLBegin(dll), DLLEnd(dll), Sum, &sum);
+	scan = SECONDS(start);
+	start = clock();
+
+	for(i = 0; i < elements; ++i)
+	{
+		DLLPopFront(dll);
+	}
+
+	printf("%-8s %10.3f %10.3f %10.3f (sum %lu)\n", "dll", push, scan, SECONDS(start),
+	       (unsigned long)sum);
+	DLLDestroy(dll);
+}
+/*****************************************************************************/
+void BenchDeque(size_t elements)
+{
+	size_t i = 0;
+	size_t sum = 0;
+	deque_t *deque = DequeCreate();
+	clock_t start = clock();
+	double push = 0;
+	double scan = 0;
+
+	for(i = 0; i < elements; ++i)
+	{
+		DequePushBack(deque, (void *)i);
+	}
+
+	push = SECONDS(start);
+	start = clock();
+	DequeForEach(DequeBegin(deque), DequeEnd(deque), Sum, &sum);
+	scan = SECONDS(start);
+	start = clock();
+
+	for(i = 0; i < elements; ++i)
+	{
+		DequePopFront(deque);
+	}
+
+	printf("%-8s %10.3f %10.3f %10.3f (sum %lu)\n", "deque", push, scan, SECONDS(start),
+	       (unsigned long)sum);
+	DequeDestroy(deque);
+}
+/*****************************************************************************/
+void BenchArray(size_t elements)
+{
+	size_t i = 0;
+	size_t sum = 0;
+	void **array = (void **)malloc(elements * sizeof(void *));
+	clock_t start = clock();
+	double push = 0;
+
+	if(NULL == array)
+	{
+		return;
+	}
+
+	for(i = 0; i < elements; ++i)
+	{
+		array[i] = (void *)i;
+	}
+
+	push = SECONDS(start);
+	start = clock();
+
+	for(i = 0; i < elements; ++i)
+	{
+		Sum(&array[i], &sum);
+	}
+
+	printf("%-8s %10.3f %10.3f %10s (sum %lu)\n", "array", push, SECONDS(start), "-",
+	       (unsigned long)sum);
+	free(array);
+}
+/*****************************************************************************/
+int Sum(void *data, void *param)
+{
+	*(size_t *)param += (size_t)*(void **)data;
+	return 0;
+}
+/*****************************************************************************/
@@ -0,0 +1,175 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This test file tests the chunked deque at both ends, across
+ *               chunk boundaries and while its ring of chunks grows.
+ * 
+******************************************************************************/
+#include <stdio.h>  /* printf, puts  */
+#include <assert.h> /* assert    :)  */
+
+#include "deque.h"  /* Internal API  */
+/*****************************************************************************/
+int AddData(void *data, void *param);
+int StopAt(void *data, void *param);
+void TestCreate(void);
+void TestPushPop(void);
+void TestGrowWrapped(void);
+void TestIteration(void);
+/*****************************************************************************/
+int main(void)
+{
+	TestCreate();
+	TestPushPop();
+	TestGrowWrapped();
+	TestIteration();
+
+	printf("\n\nDone!\n\n");
+	return 0;
+}
+/*****************************************************************************/
+void TestCreate(void)
+{
+	deque_t *deque = DequeCreate();
+
+	assert(deque);
+	assert(DequeIsEmpty(deque));
+	assert(0 == DequeCount(deque));
+	assert(DequeIterIsEqual(DequeBegin(deque), DequeEnd(deque)));
+
+	DequeDestroy(deque);
+	puts("\nCreation of deque passed successfully.");
+}
+/*****************************************************************************/
+void TestPushPop(void)
+{
+	size_t i = 0;
+	int status = 0;
+	void *data = NULL;
+	deque_t *deque = DequeCreate();
+
+	/* Enough to grow the ring a few times from both ends */
+	for(i = 0; i < 5000; ++i)
+	{
+		status = DequePushBack(deque, (void *)(i + 1));
+		assert(0 == status);
+		status = DequePushFront(deque, (void *)(-(long)i - 1));
+		assert(0 == status);
+	}
+
+	assert(10000 == DequeCount(deque));
+
+	for(i = 0; i < 5000; ++i)
+	{
+		assert((void *)(-4999L + (long)i - 1) == DequeGet(deque, i));
+		assert((void *)(i + 1) == DequeGet(deque, 5000 + i));
+	}
+
+	for(i = 5000; i; --i)
+	{
+		data = DequePopBack(deque);
+		assert((void *)i == data);
+		data = DequePopFront(deque);
+		assert((void *)(-(long)i) == data);
+	}
+
+	assert(DequeIsEmpty(deque));
+
+	/* Reusing the chunks after the deque drained */
+	for(i = 0; i < 1000; ++i)
+	{
+		status = DequePushFront(deque, (void *)i);
+		assert(0 == status);
+	}
+
+	for(i = 0; i < 1000; ++i)
+	{
+		data = DequePopBack(deque);
+		assert((void *)i == data);
+	}
+
+	DequeDestroy(deque);
+	puts("\nPush and pop of deque passed successfully.");
+}
+/*****************************************************************************/
+void TestGrowWrapped(void)
+{
+	size_t i = 0;
+	size_t next = 0;
+	void *data = NULL;
+	deque_t *deque = DequeCreate();
+
+	/* Sliding the deque so that its front is in the middle of a chunk */
+	for(i = 0; i < 100; ++i)
+	{
+		DequePushBack(deque, (void *)next++);
+		DequePopFront(deque);
+	}
+
+	for(i = 0; i < 3000; ++i)
+	{
+		DequePushBack(deque, (void *)next++);
+	}
+
+	for(i = 0; i < 3000; ++i)
+	{
+		assert((void *)(100 + i) == DequeGet(deque, i));
+	}
+
+	DequeSet(deque, 2999, (void *)7);
+	data = DequePopBack(deque);
+	assert((void *)7 == data);
+
+	DequeDestroy(deque);
+	puts("\nGrowing a wrapped deque passed successfully.");
+}
+/*****************************************************************************/
+void TestIteration(void)
+{
+	size_t i = 0;
+	size_t add = 10;
+	size_t stop = 500;
+	int status = 0;
+	deque_t *deque = DequeCreate();
+	deque_iter_t iter;
+
+	for(i = 0; i < 1000; ++i)
+	{
+		DequePushFront(deque, (void *)(999 - i));
+	}
+
+	status = DequeForEach(DequeBegin(deque), DequeEnd(deque), AddData, &add);
+	assert(0 == status);
+
+	for(i = 0, iter = DequeBegin(deque); !DequeIterIsEqual(iter, DequeEnd(deque));
+	    ++i, iter = DequeNext(iter))
+	{
+		assert((void *)(i + 10) == DequeGetData(iter));
+	}
+
+	assert(1000 == i);
+
+	iter = DequePrev(DequeEnd(deque));
+	DequeSetData(iter, (void *)0);
+	assert((void *)0 == DequeGet(deque, 999));
+
+	status = DequeForEach(DequeBegin(deque), DequeEnd(deque), StopAt, &stop);
+	assert(1 == status);
+	status = DequeForEach(DequeBegin(deque), DequeBegin(deque), StopAt, &stop);
+	assert(0 == status);
+
+	DequeDestroy(deque);
+	puts("\nIteration of deque passed successfully.");
+}
+/*****************************************************************************/
+int AddData(void *data, void *param)
+{
+	*(size_t *)data += *(size_t *)param;
+	return 0;
+}
+/*****************************************************************************/
+int StopAt(void *data, void *param)
+{
+	return (*(size_t *)data == *(size_t *)param);
+}
+/*****************************************************************************/
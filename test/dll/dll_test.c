@@ -10,13 +10,20 @@
 #include <stdlib.h> /* malloc, free  */
 #include <assert.h> /* assert    :)  */
 
-#include "dll.h"    /* Internal API  */
+#include "dll.h"        /* Internal API  */
+#include "dll_inline.h" /* Inline API    */
 /*****************************************************************************/
 dll_t *Create(void);
 void PrintDLL(dll_t *dll);
 int Cmp(void *data, void *param);
 void PrintLinkedList(dll_t *dll);
 void TestArrangeLinkedList(void);
+void TestInlineIteration(void);
+void TestPushBackMany(void);
+void TestGetMoved(void);
+void TestCursor(void);
+int Record(void *data, void *param);
+int PurgeOdd(void *data, void *param);
 int AddData(void *data, void *parameter);
 int DLLPrint(void *data, void *parameter);
 /*****************************************************************************/
@@ -42,26 +49,26 @@ int main(void)
 
 	for(; 10 > i; ++i)
 	{
-		iter = DLLInsertAfter(iter, *(void **)&i);
+		iter = DLLInsertAfter(iter, (void *)(size_t)i);
 	}
 
 	iter = DLLBegin(dll2);
 	DLLInsertBefore(iter, (void *)20);
 	for(i = 21; 31 > i; ++i)
 	{
-		iter = DLLInsertAfter(iter, *(void **)&i);
+		iter = DLLInsertAfter(iter, (void *)(size_t)i);
 	}
 
 	printf("\nDLL size after inserting : %lu.\n", DLLCount(dll));
 	printf("\nDLL after inserting : ");
 	PrintDLL(dll);
 
-	DLLForEach(DLLBegin(dll), DLLEnd(dll), AddData, *(void **)&j);
+	DLLForEach(DLLBegin(dll), DLLEnd(dll), AddData, (void *)(size_t)j);
 	printf("\n\nDLL after for each +%d and insert before : ", j);
 
 	for(i = 2; i; --i)
 	{
-		iter = DLLInsertBefore(DLLBegin(dll), *(void **)&i);
+		iter = DLLInsertBefore(DLLBegin(dll), (void *)(size_t)i);
 	}
 
 	PrintDLL(dll);
@@ -127,7 +134,11 @@ int main(void)
 	DLLDestroy(dll3);
 	DLLDestroy(dll2);
 	DLLDestroy(dll);
-	/*TestArrangeLinkedList();*/
+	TestInlineIteration();
+	TestPushBackMany();
+	TestGetMoved();
+	TestCursor();
+	TestArrangeLinkedList();
     return 0;
 }
 /*****************************************************************************/
@@ -211,6 +222,262 @@ void TestArrangeLinkedList(void)
     printf("Modified list (arranged around %d): ", pivot);
     PrintLinkedList(dll);
 
+    /* 9 lower values, the pivot, then 2 greater values */
+    for(i = 0; i < num_values; ++i)
+    {
+        int value = *(int *)DLLPopFront(dll);
+        assert((i < 9) ? (value < pivot) : (9 == i) ? (value == pivot) : (value > pivot));
+    }
+
+    DLLArrange(dll, &pivot);
+    assert(DLLIsEmpty(dll));
+
     DLLDestroy(dll);
 }
 /*****************************************************************************/
+void TestInlineIteration(void)
+{
+	size_t i = 0;
+	dll_t *dll = DLLCreate();
+	dll_iter_t iter = NULL;
+	dll_iter_t inline_iter = NULL;
+
+	for(i = 0; i < 10; ++i)
+	{
+		DLLPushBack(dll, (void *)i);
+	}
+
+	iter = DLLBegin(dll);
+	inline_iter = DLLInlineBegin(dll);
+	assert(DLLInlineIterIsEqual(iter, inline_iter));
+
+	for(i = 0; !DLLInlineIterIsEqual(inline_iter, DLLInlineEnd(dll)); ++i)
+	{
+		assert(i == (size_t)DLLInlineGetData(inline_iter));
+		assert(DLLGetData(iter) == DLLInlineGetData(inline_iter));
+		DLLInlineSetData(inline_iter, (void *)(i * 2));
+		assert((void *)(i * 2) == DLLGetData(iter));
+		iter = DLLNext(iter);
+		inline_iter = DLLInlineNext(inline_iter);
+	}
+
+	assert(10 == i);
+	assert(DLLIterIsEqual(DLLEnd(dll), inline_iter));
+	assert(DLLPrev(DLLEnd(dll)) == DLLInlinePrev(DLLInlineEnd(dll)));
+
+	puts("Inline iteration matches out-of-line iteration.\n");
+	DLLDestroy(dll);
+}
+/*****************************************************************************/
+void TestPushBackMany(void)
+{
+	size_t i = 0;
+	void *data[8] = {NULL};
+	dll_t *dll = DLLCreate();
+	dll_iter_t iter = NULL;
+
+	for(i = 0; i < 8; ++i)
+	{
+		data[i] = (void *)(i + 1);
+	}
+
+	iter = DLLPushBackMany(dll, data, 0);
+	assert(DLLIterIsEqual(iter, DLLEnd(dll)));
+	assert(DLLIsEmpty(dll));
+
+	DLLPushBack(dll, (void *)0);
+	iter = DLLPushBackMany(dll, data, 8);
+	assert(1 == (size_t)DLLGetData(iter));
+	assert(9 == DLLCount(dll));
+
+	for(i = 0, iter = DLLBegin(dll); !DLLIterIsEqual(iter, DLLEnd(dll)); ++i)
+	{
+		assert(i == (size_t)DLLGetData(iter));
+		iter = DLLNext(iter);
+	}
+
+	data[0] = DLLPopBack(dll);
+	assert(8 == (size_t)data[0]);
+	assert(7 == (size_t)DLLGetData(DLLPrev(DLLEnd(dll))));
+
+	puts("Push back of many elements passed successfully.\n");
+	DLLDestroy(dll);
+}
+/*****************************************************************************/
+void TestGetMoved(void)
+{
+	size_t i = 0;
+	void *moved = NULL;
+	dll_t *dll = DLLCreate();
+	dll_t *other = DLLCreate();
+	dll_iter_t iter = NULL;
+	dll_iter_t other_end = NULL;
+
+	for(i = 0; i < 5; ++i)
+	{
+		DLLPushBack(dll, (void *)i);
+	}
+
+	DLLPushBack(other, (void *)7);
+
+	/* The next data move into the removed node, the end is not data */
+	iter = DLLNext(DLLBegin(dll));
+	moved = DLLRemoveGetMoved(iter);
+	assert((void *)2 == moved);
+	assert(moved == DLLGetData(iter));
+
+	iter = DLLPrev(DLLEnd(dll));
+	moved = DLLRemoveGetMoved(iter);
+	assert(NULL == moved);
+	assert(DLLIterIsEqual(iter, DLLEnd(dll)));
+
+	/* The first spliced data take the old end, the data after the range
+	 * take the node of source_from */
+	other_end = DLLEnd(other);
+	iter = DLLBegin(dll);
+	moved = DLLSpliceGetMoved(other_end, iter, DLLNext(iter));
+	assert((void *)2 == moved);
+	assert(moved == DLLGetData(iter));
+	assert((void *)0 == DLLGetData(other_end));
+	assert(2 == DLLCount(other));
+
+	moved = DLLSpliceGetMoved(DLLEnd(other), DLLBegin(dll), DLLEnd(dll));
+	assert(NULL == moved);
+	assert(DLLIsEmpty(dll));
+	assert(4 == DLLCount(other));
+
+	puts("Data moved by removing and splicing passed successfully.\n");
+	DLLDestroy(other);
+	DLLDestroy(dll);
+}
+/*****************************************************************************/
+void TestCursor(void)
+{
+	size_t i = 0;
+	size_t value = 0;
+	int status = 0;
+	size_t visited[16] = {0};
+	size_t expected[] = {0, 1, 2, 4, 50, 5, 6, 7, 8, 10};
+	void *purge[2] = {NULL, NULL};
+	dll_t *dll = DLLCreate();
+	dll_t *other = DLLCreate();
+	dll_cursor_t *cursor = NULL;
+	dll_cursor_t *purger = NULL;
+
+	for(i = 0; i < 10; ++i)
+	{
+		DLLPushBack(dll, (void *)i);
+	}
+
+	/* visited[0] counts the visits, the values follow */
+	cursor = DLLCursorCreate(DLLBegin(dll), DLLEnd(dll), Record, visited);
+	assert(cursor);
+	status = DLLCursorStep(cursor, 3);
+	assert(0 == status);
+	assert(!DLLCursorIsDone(cursor));
+
+	/* Pushed before the cursor: skipped. Its next element removed: moves on */
+	DLLPushFront(dll, (void *)100);
+	DLLRemove(DLLFind(DLLBegin(dll), DLLEnd(dll), Cmp, (void *)3));
+	DLLInsertBefore(DLLFind(DLLBegin(dll), DLLEnd(dll), Cmp, (void *)5), (void *)50);
+	DLLPushBack(dll, (void *)10);
+	DLLPopBack(dll);
+	DLLRemove(DLLFind(DLLBegin(dll), DLLEnd(dll), Cmp, (void *)9));
+	DLLPushBack(dll, (void *)10);
+
+	while(!DLLCursorIsDone(cursor))
+	{
+		status = DLLCursorStep(cursor, 2);
+		assert(0 == status);
+	}
+
+	assert(10 == visited[0]);
+	for(i = 0; i < 10; ++i)
+	{
+		assert(expected[i] == visited[i + 1]);
+	}
+
+	DLLCursorDestroy(cursor);
+
+	/* A purge removing the visited element, next to a cursor ending early */
+	for(i = 0; i < 1000; ++i)
+	{
+		DLLPushBack(other, (void *)i);
+	}
+
+	visited[0] = 0;
+	cursor = DLLCursorCreate(DLLBegin(other), DLLFind(DLLBegin(other), DLLEnd(other), Cmp, (void *)5), Record, visited);
+	purger = DLLCursorCreate(DLLBegin(other), DLLEnd(other), PurgeOdd, purge);
+	purge[0] = purger;
+
+	status = DLLCursorStep(purger, 7);
+	assert(0 == status);
+	DLLRemove(DLLFind(DLLBegin(other), DLLEnd(other), Cmp, (void *)4));
+
+	/* The end of the range is removed: the range ends at the element after */
+	DLLRemove(DLLFind(DLLBegin(other), DLLEnd(other), Cmp, (void *)6));
+	status = DLLCursorStep(cursor, 100);
+	assert(0 == status);
+	assert(DLLCursorIsDone(cursor));
+	assert(2 == visited[0] && 0 == visited[1] && 2 == visited[2]);
+	DLLCursorDestroy(cursor);
+
+	while(!DLLCursorIsDone(purger))
+	{
+		status = DLLCursorStep(purger, 7);
+		assert(0 == status);
+	}
+
+	DLLCursorDestroy(purger);
+	assert(1000 == (size_t)purge[1]);
+	assert(498 == DLLCount(other));
+	for(i = 0; i < 1000; i += 2)
+	{
+		if(4 != i && 6 != i)
+		{
+			value = (size_t)DLLPopFront(other);
+			assert(i == value);
+		}
+	}
+
+	/* A range spliced away ends at the end of the list it moved to */
+	cursor = DLLCursorCreate(DLLBegin(dll), DLLEnd(dll), Record, visited);
+	status = DLLCursorStep(cursor, 2);
+	assert(0 == status);
+	DLLSplice(DLLEnd(other), DLLNext(DLLBegin(dll)), DLLPrev(DLLEnd(dll)));
+	status = DLLCursorStep(cursor, 100);
+	assert(0 == status);
+	assert(DLLCursorIsDone(cursor));
+	DLLCursorDestroy(cursor);
+
+	puts("Resumable cursors passed successfully.\n");
+	DLLDestroy(other);
+	DLLDestroy(dll);
+}
+/*****************************************************************************/
+int Record(void *data, void *param)
+{
+	size_t *visited = (size_t *)param;
+
+	++visited[0];
+	if(visited[0] < 16)
+	{
+		visited[visited[0]] = (size_t)*(void **)data;
+	}
+
+	return (0);
+}
+/*****************************************************************************/
+int PurgeOdd(void *data, void *param)
+{
+	void **purge = (void **)param;
+
+	purge[1] = (void *)((size_t)purge[1] + 1);
+	if((size_t)*(void **)data % 2)
+	{
+		DLLRemove(DLLCursorCurrent((dll_cursor_t *)purge[0]));
+	}
+
+	return (0);
+}
+/*****************************************************************************/
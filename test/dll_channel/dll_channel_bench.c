@@ -0,0 +1,235 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This benchmark compares a consumer thread busy polling a list
+ *               behind a lock with DLLIsEmpty against one blocking on the
+ *               channel. Throughput sends the data as fast as possible, latency
+ *               sends them spaced out. Both report the wall clock time and the
+ *               CPU time of the process, which the busy polling wastes.
+ *
+ *               Usage: dll_channel_bench [number of data]
+ *
+******************************************************************************/
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>         /* printf               */
+#include <stdlib.h>        /* malloc, free, strtoul */
+#include <time.h>          /* clock, nanosleep     */
+#include <pthread.h>       /* pthread_create       */
+
+#include "dll.h"           /* Internal API         */
+#include "dll_channel.h"   /* Internal API         */
+/*****************************************************************************/
+#define DEFAULT_DATA (1000000UL)
+#define LATENCY_DATA (2000UL)
+#define LATENCY_GAP_NS (50000L)
+#define CAPACITY (1024)
+#define CPU_SECONDS(start) ((double)(clock() - (start)) / CLOCKS_PER_SEC)
+
+typedef struct bench
+{
+	int is_channel;
+	dll_channel_t *channel;
+	dll_t *dll;
+	pthread_mutex_t lock;
+	size_t count;
+	long gap_ns;
+	double *sent_at;
+	double latency;
+	size_t sum;
+
+} bench_t;
+/*****************************************************************************/
+double Seconds(void);
+void *Produce(void *param);
+void *Consume(void *param);
+void Receive(bench_t *bench, size_t data);
+int Run(bench_t *bench, int is_channel, double *wall, double *cpu);
+void Bench(size_t count, long gap_ns, const char *title);
+/*****************************************************************************/
+int main(int argc, char *argv[])
+{
+	size_t count = (1 < argc) ? strtoul(argv[1], NULL, 10) : DEFAULT_DATA;
+
+	printf("%-22s %12s %12s %12s %12s %12s\n", "", "poll wall", "poll cpu",
+	       "chan wall", "chan cpu", "checksum");
+	Bench(count, 0, "throughput (s)");
+	Bench(LATENCY_DATA, LATENCY_GAP_NS, "latency (s)");
+
+	return 0;
+}
+/*****************************************************************************/
+void Bench(size_t count, long gap_ns, const char *title)
+{
+	bench_t poll_bench;
+	bench_t channel_bench;
+	double poll_wall = 0;
+	double poll_cpu = 0;
+	double channel_wall = 0;
+	double channel_cpu = 0;
+
+	poll_bench.count = channel_bench.count = count;
+	poll_bench.gap_ns = channel_bench.gap_ns = gap_ns;
+
+	if(0 != Run(&poll_bench, 0, &poll_wall, &poll_cpu) ||
+	   0 != Run(&channel_bench, 1, &channel_wall, &channel_cpu))
+	{
+		printf("%-22s failed\n", title);
+		return;
+	}
+
+	printf("%-22s %12.4f %12.4f %12.4f %12.4f %12s\n", title, poll_wall, poll_cpu,
+	       channel_wall, channel_cpu,
+	       (poll_bench.sum == channel_bench.sum) ? "match" : "MISMATCH");
+
+	/* Spaced out data are timed one by one */
+	if(0 < gap_ns)
+	{
+		printf("%-22s %12.2f %12s %12.2f\n", "mean latency (us)",
+		       poll_bench.latency * 1e6 / count, "",
+		       channel_bench.latency * 1e6 / count);
+	}
+}
+/*****************************************************************************/
+int Run(bench_t *bench, int is_channel, double *wall, double *cpu)
+{
+	pthread_t producer;
+	pthread_t consumer;
+	clock_t start_cpu = 0;
+	double start = 0;
+
+	bench->is_channel = is_channel;
+	bench->channel = DLLChannelCreate(CAPACITY);
+	bench->dll = DLLCreate();
+	bench->sent_at = (double *)malloc(bench->count * sizeof(double));
+	bench->latency = 0;
+	bench->sum = 0;
+
+	if(NULL == bench->channel || NULL == bench->dll || NULL == bench->sent_at ||
+	   0 != pthread_mutex_init(&bench->lock, NULL))
+	{
+		return (-1);
+	}
+
+	start = Seconds();
+	start_cpu = clock();
+
+	pthread_create(&consumer, NULL, Consume, bench);
+	pthread_create(&producer, NULL, Produce, bench);
+	pthread_join(producer, NULL);
+	pthread_join(consumer, NULL);
+
+	*wall = Seconds() - start;
+	*cpu = CPU_SECONDS(start_cpu);
+
+	pthread_mutex_destroy(&bench->lock);
+	free(bench->sent_at);
+	DLLDestroy(bench->dll);
+	DLLChannelDestroy(bench->channel);
+
+	return (0);
+}
+/*****************************************************************************/
+void *Produce(void *param)
+{
+	bench_t *bench = (bench_t *)param;
+	struct timespec gap;
+	size_t i = 0;
+
+	gap.tv_sec = 0;
+	gap.tv_nsec = bench->gap_ns;
+
+	/* Data are 1 to count, the list ends with NULL */
+	for(i = 1; i <= bench->count; ++i)
+	{
+		if(0 < bench->gap_ns)
+		{
+			nanosleep(&gap, NULL);
+		}
+
+		bench->sent_at[i - 1] = Seconds();
+
+		if(bench->is_channel)
+		{
+			DLLChannelSend(bench->channel, (void *)i);
+		}
+		else
+		{
+			pthread_mutex_lock(&bench->lock);
+			DLLPushBack(bench->dll, (void *)i);
+			pthread_mutex_unlock(&bench->lock);
+		}
+	}
+
+	if(bench->is_channel)
+	{
+		DLLChannelClose(bench->channel);
+	}
+	else
+	{
+		pthread_mutex_lock(&bench->lock);
+		DLLPushBack(bench->dll, NULL);
+		pthread_mutex_unlock(&bench->lock);
+	}
+
+	return (NULL);
+}
+/*****************************************************************************/
+void *Consume(void *param)
+{
+	bench_t *bench = (bench_t *)param;
+	void *data = NULL;
+
+	if(bench->is_channel)
+	{
+		while(DLL_CHANNEL_SUCCESS == DLLChannelReceive(bench->channel, &data))
+		{
+			Receive(bench, (size_t)data);
+		}
+
+		return (NULL);
+	}
+
+	for(;;)
+	{
+		int is_received = 0;
+
+		pthread_mutex_lock(&bench->lock);
+		if(!DLLIsEmpty(bench->dll))
+		{
+			data = DLLPopFront(bench->dll);
+			is_received = 1;
+		}
+		pthread_mutex_unlock(&bench->lock);
+
+		if(is_received && NULL == data)
+		{
+			return (NULL);
+		}
+
+		if(is_received)
+		{
+			Receive(bench, (size_t)data);
+		}
+	}
+}
+/*****************************************************************************/
+void Receive(bench_t *bench, size_t data)
+{
+	if(0 < bench->gap_ns)
+	{
+		bench->latency += Seconds() - bench->sent_at[data - 1];
+	}
+
+	bench->sum += data;
+}
+/*****************************************************************************/
+double Seconds(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return ((double)now.tv_sec + (double)now.tv_nsec / 1e9);
+}
+/*****************************************************************************/
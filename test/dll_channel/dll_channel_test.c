@@ -0,0 +1,336 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This test file tests the channel: the non-blocking functions
+ *               and the readiness of the descriptors, closing, sending and
+ *               receiving many, and threads blocking on a small channel.
+ *
+******************************************************************************/
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>         /* printf          */
+#include <assert.h>        /* assert    :)    */
+#include <pthread.h>       /* pthread_create  */
+#include <poll.h>          /* poll            */
+
+#include "dll_channel.h"   /* Internal API    */
+/*****************************************************************************/
+#define CAPACITY (4)
+#define ITEMS (64)
+#define PRODUCERS (3)
+#define CONSUMERS (2)
+#define THREAD_ITEMS (20000)
+#define BATCH (5)
+
+typedef struct worker
+{
+	dll_channel_t *channel;
+	size_t index;
+	size_t received;
+	size_t sum;
+
+} worker_t;
+/*****************************************************************************/
+int IsReadable(int fd);
+void *Produce(void *param);
+void *Consume(void *param);
+void *ReceiveOne(void *param);
+void TestTry(void);
+void TestClose(void);
+void TestMany(void);
+void TestThreads(void);
+void TestWakeOnClose(void);
+/*****************************************************************************/
+int main(void)
+{
+	TestTry();
+	TestClose();
+	TestMany();
+	TestThreads();
+	TestWakeOnClose();
+
+	printf("\n\nDone!\n\n");
+	return 0;
+}
+/*****************************************************************************/
+void TestTry(void)
+{
+	static size_t items[CAPACITY];
+	dll_channel_t *channel = DLLChannelCreate(CAPACITY);
+	dll_channel_status_t status = DLL_CHANNEL_SUCCESS;
+	void *data = NULL;
+	size_t round = 0;
+	size_t i = 0;
+
+	assert(channel);
+	assert(!IsReadable(DLLChannelReceiveFd(channel)));
+	assert(IsReadable(DLLChannelSendFd(channel)));
+	status = DLLChannelTryReceive(channel, &data);
+	assert(DLL_CHANNEL_WOULD_BLOCK == status);
+
+	for(round = 0; round < 2; ++round)
+	{
+		for(i = 0; i < CAPACITY; ++i)
+		{
+			status = DLLChannelTrySend(channel, &items[i]);
+			assert(DLL_CHANNEL_SUCCESS == status);
+			assert(IsReadable(DLLChannelReceiveFd(channel)));
+			assert(i + 1 == DLLChannelCount(channel));
+		}
+
+		status = DLLChannelTrySend(channel, &items[0]);
+		assert(DLL_CHANNEL_WOULD_BLOCK == status);
+		assert(!IsReadable(DLLChannelSendFd(channel)));
+
+		for(i = 0; i < CAPACITY; ++i)
+		{
+			status = DLLChannelTryReceive(channel, &data);
+			assert(DLL_CHANNEL_SUCCESS == status);
+			assert(&items[i] == data);
+			assert(IsReadable(DLLChannelSendFd(channel)));
+		}
+
+		status = DLLChannelTryReceive(channel, &data);
+		assert(DLL_CHANNEL_WOULD_BLOCK == status);
+		assert(!IsReadable(DLLChannelReceiveFd(channel)));
+		assert(0 == DLLChannelCount(channel));
+	}
+
+	DLLChannelDestroy(channel);
+}
+/*****************************************************************************/
+void TestClose(void)
+{
+	static size_t items[CAPACITY];
+	dll_channel_t *channel = DLLChannelCreate(CAPACITY);
+	dll_channel_status_t status = DLL_CHANNEL_SUCCESS;
+	void *data = NULL;
+	size_t count = 0;
+	size_t i = 0;
+
+	assert(channel);
+
+	for(i = 0; i < CAPACITY; ++i)
+	{
+		status = DLLChannelSend(channel, &items[i]);
+		assert(DLL_CHANNEL_SUCCESS == status);
+	}
+
+	DLLChannelClose(channel);
+	assert(IsReadable(DLLChannelSendFd(channel)));
+	status = DLLChannelTrySend(channel, &items[0]);
+	assert(DLL_CHANNEL_CLOSED == status);
+	status = DLLChannelSend(channel, &items[0]);
+	assert(DLL_CHANNEL_CLOSED == status);
+	count = DLLChannelSendMany(channel, &data, 1);
+	assert(0 == count);
+
+	/* What was sent before closing is still received */
+	for(i = 0; i < CAPACITY; ++i)
+	{
+		status = DLLChannelReceive(channel, &data);
+		assert(DLL_CHANNEL_SUCCESS == status);
+		assert(&items[i] == data);
+	}
+
+	assert(IsReadable(DLLChannelReceiveFd(channel)));
+	status = DLLChannelTryReceive(channel, &data);
+	assert(DLL_CHANNEL_CLOSED == status);
+	status = DLLChannelReceive(channel, &data);
+	assert(DLL_CHANNEL_CLOSED == status);
+	count = DLLChannelReceiveMany(channel, &data, 1);
+	assert(0 == count);
+
+	DLLChannelDestroy(channel);
+}
+/*****************************************************************************/
+void TestMany(void)
+{
+	static size_t items[ITEMS];
+	void *sent[ITEMS];
+	void *received[ITEMS];
+	dll_channel_t *channel = DLLChannelCreate(ITEMS);
+	size_t count = 0;
+	size_t i = 0;
+
+	assert(channel);
+
+	for(i = 0; i < ITEMS; ++i)
+	{
+		sent[i] = &items[i];
+	}
+
+	count = DLLChannelSendMany(channel, sent, ITEMS / 2);
+	assert(ITEMS / 2 == count);
+	count = DLLChannelSendMany(channel, sent + ITEMS / 2, ITEMS / 2);
+	assert(ITEMS / 2 == count);
+	assert(!IsReadable(DLLChannelSendFd(channel)));
+
+	count = DLLChannelReceiveMany(channel, received, BATCH);
+	assert(BATCH == count);
+	count = DLLChannelReceiveMany(channel, received + BATCH, ITEMS);
+	assert(ITEMS - BATCH == count);
+
+	for(i = 0; i < ITEMS; ++i)
+	{
+		assert(&items[i] == received[i]);
+	}
+
+	assert(!IsReadable(DLLChannelReceiveFd(channel)));
+
+	DLLChannelDestroy(channel);
+}
+/*****************************************************************************/
+void TestThreads(void)
+{
+	pthread_t producers[PRODUCERS];
+	pthread_t consumers[CONSUMERS];
+	worker_t workers[PRODUCERS + CONSUMERS];
+	dll_channel_t *channel = DLLChannelCreate(CAPACITY);
+	size_t received = 0;
+	size_t sum = 0;
+	int status = 0;
+	size_t i = 0;
+
+	assert(channel);
+
+	for(i = 0; i < PRODUCERS + CONSUMERS; ++i)
+	{
+		workers[i].channel = channel;
+		workers[i].index = i;
+		workers[i].received = 0;
+		workers[i].sum = 0;
+	}
+
+	for(i = 0; i < CONSUMERS; ++i)
+	{
+		status = pthread_create(&consumers[i], NULL, Consume, &workers[PRODUCERS + i]);
+		assert(0 == status);
+	}
+
+	for(i = 0; i < PRODUCERS; ++i)
+	{
+		status = pthread_create(&producers[i], NULL, Produce, &workers[i]);
+		assert(0 == status);
+	}
+
+	for(i = 0; i < PRODUCERS; ++i)
+	{
+		status = pthread_join(producers[i], NULL);
+		assert(0 == status);
+	}
+
+	DLLChannelClose(channel);
+
+	for(i = 0; i < CONSUMERS; ++i)
+	{
+		status = pthread_join(consumers[i], NULL);
+		assert(0 == status);
+		received += workers[PRODUCERS + i].received;
+		sum += workers[PRODUCERS + i].sum;
+	}
+
+	assert(PRODUCERS * THREAD_ITEMS == received);
+	assert(PRODUCERS * ((size_t)THREAD_ITEMS * (THREAD_ITEMS + 1) / 2) == sum);
+
+	DLLChannelDestroy(channel);
+}
+/*****************************************************************************/
+void TestWakeOnClose(void)
+{
+	pthread_t consumer;
+	worker_t worker;
+	dll_channel_t *channel = DLLChannelCreate(CAPACITY);
+	int status = 0;
+
+	assert(channel);
+
+	worker.channel = channel;
+	worker.received = 0;
+
+	status = pthread_create(&consumer, NULL, ReceiveOne, &worker);
+	assert(0 == status);
+	DLLChannelClose(channel);
+	status = pthread_join(consumer, NULL);
+	assert(0 == status);
+	assert(0 == worker.received);
+
+	DLLChannelDestroy(channel);
+}
+/*****************************************************************************/
+void *Produce(void *param)
+{
+	worker_t *worker = (worker_t *)param;
+	void *batch[BATCH];
+	dll_channel_status_t status = DLL_CHANNEL_SUCCESS;
+	size_t sent = 0;
+	size_t i = 1;
+	size_t j = 0;
+
+	/* Even producers send one at a time, odd ones in batches */
+	while(i <= THREAD_ITEMS)
+	{
+		if(0 == worker->index % 2)
+		{
+			status = DLLChannelSend(worker->channel, (void *)i);
+			assert(DLL_CHANNEL_SUCCESS == status);
+			++i;
+			continue;
+		}
+
+		for(j = 0; j < BATCH && i <= THREAD_ITEMS; ++j, ++i)
+		{
+			batch[j] = (void *)i;
+		}
+
+		sent = DLLChannelSendMany(worker->channel, batch, j);
+		assert(j == sent);
+	}
+
+	return (NULL);
+}
+/*****************************************************************************/
+void *Consume(void *param)
+{
+	worker_t *worker = (worker_t *)param;
+	void *batch[BATCH];
+	size_t received = 0;
+	size_t i = 0;
+
+	while(0 < (received = DLLChannelReceiveMany(worker->channel, batch, BATCH)))
+	{
+		for(i = 0; i < received; ++i)
+		{
+			worker->sum += (size_t)batch[i];
+		}
+
+		worker->received += received;
+	}
+
+	return (NULL);
+}
+/*****************************************************************************/
+void *ReceiveOne(void *param)
+{
+	worker_t *worker = (worker_t *)param;
+	void *data = NULL;
+
+	if(DLL_CHANNEL_SUCCESS == DLLChannelReceive(worker->channel, &data))
+	{
+		++worker->received;
+	}
+
+	return (NULL);
+}
+/*****************************************************************************/
+int IsReadable(int fd)
+{
+	struct pollfd ready;
+
+	ready.fd = fd;
+	ready.events = POLLIN;
+	ready.revents = 0;
+
+	return (1 == poll(&ready, 1, 0) && (ready.revents & POLLIN));
+}
+/*****************************************************************************/
@@ -0,0 +1,568 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This differential harness decodes a byte string into list
+ *               operations on two lists, applies each one to the lists and to
+ *               an array model of them, and compares the two after every step,
+ *               checking the links and the dummy tail of each list as well.
+ *
+ *               Usage: dll_fuzz_test                 quick stress run
+ *                      dll_fuzz_test --stress SECONDS long stress run
+ *                      dll_fuzz_test --seed SEED      replays a stress run
+ *                      dll_fuzz_test FILE...          replays inputs, "-" is
+ *                                                     stdin (AFL: @@)
+ *
+ *               Built with -DDLL_FUZZ_LIBFUZZER, only LLVMFuzzerTestOneInput
+ *               is defined, for -fsanitize=fuzzer.
+ *
+******************************************************************************/
+#include <stdio.h>         /* printf, fprintf, fopen */
+#include <stdlib.h>        /* abort, strtoul         */
+#include <string.h>        /* strcmp, memmove        */
+#include <time.h>          /* time                   */
+
+#include "dll.h"           /* Internal API           */
+/*****************************************************************************/
+#define LISTS (2)
+#define MAX_ELEMENTS (256)
+#define POOL_SIZE (256)
+#define MAX_INPUT (4096)
+#define QUICK_RUNS (3000)
+#define CHECK(condition) ((condition) ? (void)0 : Fail(#condition, __LINE__))
+
+typedef struct input
+{
+	const unsigned char *data;
+	size_t size;
+	size_t position;
+
+} input_t;
+
+typedef struct model
+{
+	size_t values[MAX_ELEMENTS];
+	size_t count;
+
+} model_t;
+
+typedef enum operation
+{
+	PUSH_BACK,
+	PUSH_FRONT,
+	POP_BACK,
+	POP_FRONT,
+	INSERT_BEFORE,
+	INSERT_AFTER,
+	REMOVE,
+	SET_DATA,
+	SPLICE,
+	FIND,
+	MULTI_FIND,
+	FOR_EACH,
+	PUSH_BACK_MANY,
+	ARRANGE,
+	OPERATIONS
+
+} operation_t;
+
+/* Data are pointers into the pool; many pool values are equal */
+static int pool[POOL_SIZE];
+static size_t step = 0;
+static unsigned long seed = 0;
+static unsigned long state = 0;
+/*****************************************************************************/
+int LLVMFuzzerTestOneInput(const unsigned char *data, size_t size);
+void RunOne(const unsigned char *data, size_t size);
+void Apply(dll_t **lists, model_t *models, input_t *input);
+void CheckList(dll_t *dll, const model_t *model);
+void CheckSameData(dll_t *dll, const model_t *model);
+dll_iter_t IterAt(dll_t *dll, size_t index);
+size_t ReadByte(input_t *input);
+size_t ReadIndex(input_t *input, size_t bound);
+void *Data(size_t value);
+size_t Value(void *data);
+int IsNotSame(void *data, void *param);
+int Shift(void *data, void *param);
+void SpliceModel(model_t *dest, size_t at, model_t *source, size_t from, size_t to);
+void Fail(const char *condition, int line);
+int RunFile(const char *path);
+int Stress(unsigned long first, unsigned long runs, time_t seconds);
+unsigned long Random(void);
+/*****************************************************************************/
+#ifndef DLL_FUZZ_LIBFUZZER
+int main(int argc, char *argv[])
+{
+	int i = 1;
+
+	if(1 == argc)
+	{
+		return (Stress(1, QUICK_RUNS, 0));
+	}
+
+	if(3 == argc && 0 == strcmp("--stress", argv[1]))
+	{
+		return (Stress(1, 0, (time_t)strtoul(argv[2], NULL, 10)));
+	}
+
+	if(3 == argc && 0 == strcmp("--seed", argv[1]))
+	{
+		return (Stress(strtoul(argv[2], NULL, 10), 1, 0));
+	}
+
+	for(; i < argc; ++i)
+	{
+		if(RunFile(argv[i]))
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+#endif /* DLL_FUZZ_LIBFUZZER */
+/*****************************************************************************/
+int LLVMFuzzerTestOneInput(const unsigned char *data, size_t size)
+{
+	RunOne(data, size);
+	return 0;
+}
+/*****************************************************************************/
+void RunOne(const unsigned char *data, size_t size)
+{
+	dll_t *lists[LISTS] = {NULL, NULL};
+	model_t models[LISTS];
+	input_t input;
+	size_t i = 0;
+
+	for(i = 0; i < POOL_SIZE; ++i)
+	{
+		pool[i] = (int)(i % 32) - 16;
+	}
+
+	input.data = data;
+	input.size = size;
+	input.position = 0;
+
+	for(i = 0; i < LISTS; ++i)
+	{
+		lists[i] = DLLCreate();
+		CHECK(NULL != lists[i]);
+		models[i].count = 0;
+	}
+
+	for(step = 0; input.position < input.size; ++step)
+	{
+		Apply(lists, models, &input);
+
+		for(i = 0; i < LISTS; ++i)
+		{
+			CheckList(lists[i], &models[i]);
+		}
+	}
+
+	for(i = 0; i < LISTS; ++i)
+	{
+		DLLDestroy(lists[i]);
+	}
+}
+/*****************************************************************************/
+void Apply(dll_t **lists, model_t *models, input_t *input)
+{
+	operation_t operation = (operation_t)(ReadByte(input) % OPERATIONS);
+	size_t which = ReadByte(input) % LISTS;
+	dll_t *dll = lists[which];
+	model_t *model = &models[which];
+	model_t *other = &models[!which];
+	dll_t *found = NULL;
+	dll_iter_t iter = NULL;
+	void *batch[8];
+	size_t value = ReadByte(input) % POOL_SIZE;
+	size_t index = 0;
+	size_t to = 0;
+	size_t i = 0;
+	int pivot = 0;
+
+	switch(operation)
+	{
+		case PUSH_BACK:
+		case PUSH_FRONT:
+		case INSERT_BEFORE:
+		case INSERT_AFTER:
+			if(MAX_ELEMENTS == model->count ||
+			   (INSERT_AFTER == operation && 0 == model->count))
+			{
+				break;
+			}
+
+			if(PUSH_BACK == operation)
+			{
+				index = model->count;
+				iter = DLLPushBack(dll, Data(value));
+			}
+			else if(PUSH_FRONT == operation)
+			{
+				iter = DLLPushFront(dll, Data(value));
+			}
+			else if(INSERT_BEFORE == operation)
+			{
+				index = ReadIndex(input, model->count + 1);
+				iter = DLLInsertBefore(IterAt(dll, index), Data(value));
+			}
+			else
+			{
+				index = ReadIndex(input, model->count);
+				iter = DLLInsertAfter(IterAt(dll, index), Data(value));
+				++index;
+			}
+
+			memmove(&model->values[index + 1], &model->values[index],
+			        (model->count - index) * sizeof(size_t));
+			model->values[index] = value;
+			++model->count;
+
+			CHECK(value == Value(DLLGetData(iter)));
+			CHECK(DLLIterIsEqual(iter, IterAt(dll, index)));
+			break;
+
+		case POP_BACK:
+		case POP_FRONT:
+		case REMOVE:
+			if(0 == model->count)
+			{
+				break;
+			}
+
+			if(POP_BACK == operation)
+			{
+				index = model->count - 1;
+				CHECK(model->values[index] == Value(DLLPopBack(dll)));
+			}
+			else if(POP_FRONT == operation)
+			{
+				CHECK(model->values[0] == Value(DLLPopFront(dll)));
+			}
+			else
+			{
+				index = ReadIndex(input, model->count);
+				iter = DLLRemove(IterAt(dll, index));
+			}
+
+			--model->count;
+			memmove(&model->values[index], &model->values[index + 1],
+			        (model->count - index) * sizeof(size_t));
+
+			if(REMOVE == operation)
+			{
+				CHECK(DLLIterIsEqual(iter, IterAt(dll, index)));
+			}
+			break;
+
+		case SET_DATA:
+			if(model->count)
+			{
+				index = ReadIndex(input, model->count);
+				DLLSetData(IterAt(dll, index), Data(value));
+				model->values[index] = value;
+			}
+			break;
+
+		case SPLICE:
+			/* A range of the other list, or of the same list around dest */
+			if(ReadByte(input) % 2)
+			{
+				index = ReadIndex(input, other->count + 1);
+				to = index + ReadIndex(input, other->count - index + 1);
+				i = ReadIndex(input, model->count + 1);
+				if(MAX_ELEMENTS < model->count + (to - index))
+				{
+					break;
+				}
+
+				DLLSplice(IterAt(dll, i), IterAt(lists[!which], index), IterAt(lists[!which], to));
+				SpliceModel(model, i, other, index, to);
+			}
+			else
+			{
+				index = ReadIndex(input, model->count + 1);
+				to = index + ReadIndex(input, model->count - index + 1);
+				i = ReadIndex(input, model->count + 1);
+				if(i > index && i < to)
+				{
+					break;
+				}
+
+				DLLSplice(IterAt(dll, i), IterAt(dll, index), IterAt(dll, to));
+				SpliceModel(model, i, model, index, to);
+			}
+			break;
+
+		case FIND:
+			iter = DLLFind(DLLBegin(dll), DLLEnd(dll), IsNotSame, Data(value));
+			for(index = 0; index < model->count && value != model->values[index]; ++index)
+			{
+			}
+
+			CHECK(DLLIterIsEqual(iter, IterAt(dll, index)));
+			break;
+
+		case MULTI_FIND:
+			index = ReadIndex(input, model->count + 1);
+			found = DLLCreate();
+			CHECK(NULL != found);
+
+			to = (size_t)DLLMultiFind(IterAt(dll, index), DLLEnd(dll), IsNotSame, Data(value), found);
+			iter = DLLBegin(found);
+
+			for(i = 0; index < model->count; ++index)
+			{
+				if(value == model->values[index])
+				{
+					CHECK(!DLLIterIsEqual(iter, DLLEnd(found)));
+					CHECK(DLLIterIsEqual(DLLGetData(iter), IterAt(dll, index)));
+					iter = DLLNext(iter);
+					++i;
+				}
+			}
+
+			CHECK(i == to);
+			CHECK(DLLIterIsEqual(iter, DLLEnd(found)));
+			DLLDestroy(found);
+			break;
+
+		case FOR_EACH:
+			index = ReadIndex(input, model->count + 1);
+			to = index + ReadIndex(input, model->count - index + 1);
+
+			CHECK(0 == DLLForEach(IterAt(dll, index), IterAt(dll, to), Shift, (void *)value));
+			for(i = index; i < to; ++i)
+			{
+				model->values[i] = (model->values[i] + value) % POOL_SIZE;
+			}
+			break;
+
+		case PUSH_BACK_MANY:
+			to = ReadByte(input) % 8;
+			if(MAX_ELEMENTS < model->count + to)
+			{
+				break;
+			}
+
+			for(i = 0; i < to; ++i)
+			{
+				batch[i] = Data((value + i) % POOL_SIZE);
+				model->values[model->count + i] = (value + i) % POOL_SIZE;
+			}
+
+			iter = DLLPushBackMany(dll, batch, to);
+			CHECK(DLLIterIsEqual(iter, IterAt(dll, model->count)));
+			model->count += to;
+			break;
+
+		case ARRANGE:
+			pivot = pool[value];
+			DLLArrange(dll, &pivot);
+
+			/* The model is rebuilt from the list, which must be a permutation */
+			CheckSameData(dll, model);
+
+			/* Lower values first, then equal ones, then greater ones */
+			for(i = 0, index = 0, iter = DLLBegin(dll); i < model->count; ++i)
+			{
+				value = (size_t)(*(int *)DLLGetData(iter) > pivot) + (*(int *)DLLGetData(iter) >= pivot);
+				CHECK(index <= value);
+				index = value;
+				model->values[i] = Value(DLLGetData(iter));
+				iter = DLLNext(iter);
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+/*****************************************************************************/
+void CheckList(dll_t *dll, const model_t *model)
+{
+	dll_iter_t iter = DLLBegin(dll);
+	dll_iter_t prev = NULL;
+	size_t i = 0;
+
+	CHECK(NULL == DLLPrev(iter));
+
+	for(i = 0; i < model->count; ++i)
+	{
+		CHECK(!DLLIterIsEqual(iter, DLLEnd(dll)));
+		CHECK(prev == DLLPrev(iter));
+		CHECK(model->values[i] == Value(DLLGetData(iter)));
+		prev = iter;
+		iter = DLLNext(iter);
+	}
+
+	/* The dummy tail points back at the tail pointer of its list */
+	CHECK(DLLIterIsEqual(iter, DLLEnd(dll)));
+	CHECK(prev == DLLPrev(iter));
+	CHECK(NULL == DLLNext(iter));
+	CHECK(*(dll_iter_t *)DLLGetData(iter) == iter);
+
+	CHECK(model->count == DLLCount(dll));
+	CHECK((0 == model->count) == DLLIsEmpty(dll));
+}
+/*****************************************************************************/
+void CheckSameData(dll_t *dll, const model_t *model)
+{
+	size_t counts[POOL_SIZE] = {0};
+	dll_iter_t iter = DLLBegin(dll);
+	size_t i = 0;
+
+	for(i = 0; i < model->count; ++i)
+	{
+		++counts[model->values[i]];
+	}
+
+	for(i = 0; i < model->count; ++i, iter = DLLNext(iter))
+	{
+		CHECK(!DLLIterIsEqual(iter, DLLEnd(dll)));
+		CHECK(0 < counts[Value(DLLGetData(iter))]);
+		--counts[Value(DLLGetData(iter))];
+	}
+
+	CHECK(DLLIterIsEqual(iter, DLLEnd(dll)));
+}
+/*****************************************************************************/
+void SpliceModel(model_t *dest, size_t at, model_t *source, size_t from, size_t to)
+{
+	size_t moved[MAX_ELEMENTS];
+	size_t count = to - from;
+
+	memmove(moved, &source->values[from], count * sizeof(size_t));
+	memmove(&source->values[from], &source->values[to], (source->count - to) * sizeof(size_t));
+	source->count -= count;
+
+	/* Within one list, dest is found after the range was taken out */
+	if(dest == source && at > from)
+	{
+		at -= count;
+	}
+
+	memmove(&dest->values[at + count], &dest->values[at], (dest->count - at) * sizeof(size_t));
+	memmove(&dest->values[at], moved, count * sizeof(size_t));
+	dest->count += count;
+}
+/*****************************************************************************/
+dll_iter_t IterAt(dll_t *dll, size_t index)
+{
+	dll_iter_t iter = DLLBegin(dll);
+
+	while(index--)
+	{
+		iter = DLLNext(iter);
+	}
+
+	return (iter);
+}
+/*****************************************************************************/
+size_t ReadByte(input_t *input)
+{
+	if(input->position < input->size)
+	{
+		return (input->data[input->position++]);
+	}
+
+	return (0);
+}
+/*****************************************************************************/
+size_t ReadIndex(input_t *input, size_t bound)
+{
+	size_t index = ReadByte(input);
+
+	index |= ReadByte(input) << 8;
+	return (bound ? index % bound : 0);
+}
+/*****************************************************************************/
+void *Data(size_t value)
+{
+	return (&pool[value]);
+}
+/*****************************************************************************/
+size_t Value(void *data)
+{
+	CHECK((int *)data >= pool && (int *)data < pool + POOL_SIZE);
+	return ((size_t)((int *)data - pool));
+}
+/*****************************************************************************/
+int IsNotSame(void *data, void *param)
+{
+	return (data != param);
+}
+/*****************************************************************************/
+int Shift(void *data, void *param)
+{
+	*(void **)data = Data((Value(*(void **)data) + (size_t)param) % POOL_SIZE);
+	return (0);
+}
+/*****************************************************************************/
+void Fail(const char *condition, int line)
+{
+	fprintf(stderr, "dll_fuzz: check failed at line %d, step %lu, seed %lu: %s\n",
+	        line, (unsigned long)step, seed, condition);
+	abort();
+}
+/*****************************************************************************/
+int RunFile(const char *path)
+{
+	static unsigned char buffer[1 << 20];
+	FILE *file = (0 == strcmp("-", path)) ? stdin : fopen(path, "rb");
+	size_t size = 0;
+
+	if(NULL == file)
+	{
+		fprintf(stderr, "dll_fuzz: can not open %s\n", path);
+		return 1;
+	}
+
+	size = fread(buffer, 1, sizeof(buffer), file);
+	if(stdin != file)
+	{
+		fclose(file);
+	}
+
+	RunOne(buffer, size);
+	return 0;
+}
+/*****************************************************************************/
+int Stress(unsigned long first, unsigned long runs, time_t seconds)
+{
+	static unsigned char buffer[MAX_INPUT];
+	time_t end = time(NULL) + seconds;
+	unsigned long run = 0;
+	size_t size = 0;
+	size_t i = 0;
+
+	for(run = 0; (runs && run < runs) || (seconds && time(NULL) < end); ++run)
+	{
+		/* Each run is replayable from its seed alone */
+		seed = first + run;
+		state = seed;
+		size = 1 + Random() % MAX_INPUT;
+
+		for(i = 0; i < size; ++i)
+		{
+			buffer[i] = (unsigned char)Random();
+		}
+
+		RunOne(buffer, size);
+	}
+
+	printf("dll_fuzz: %lu runs passed\n", run);
+	return 0;
+}
+/*****************************************************************************/
+unsigned long Random(void)
+{
+	/* xorshift on 32 bits, seeded per run */
+	state ^= (state << 13) & 0xFFFFFFFFUL;
+	state ^= state >> 17;
+	state ^= (state << 5) & 0xFFFFFFFFUL;
+	return (state);
+}
+/*****************************************************************************/
@@ -0,0 +1,127 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This benchmark compares building a list from a file of lines
+ *               with the streaming bulk loader against the naive loop of
+ *               reading, copying and calling DLLPushBack on every record.
+ *
+ *               Usage: dll_load_bench [number of records]
+ * 
+******************************************************************************/
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>    /* printf, fopen, fgets, remove */
+#include <stdlib.h>   /* malloc, free, strtoul        */
+#include <string.h>   /* strlen, memcpy               */
+#include <assert.h>   /* assert    :)                 */
+#include <time.h>     /* clock                        */
+#include <fcntl.h>    /* open                         */
+#include <unistd.h>   /* close                        */
+
+#include "dll.h"      /* Internal API                 */
+#include "dll_load.h" /* Internal API                 */
+/*****************************************************************************/
+#define PATH ("dll_load_bench.txt")
+#define DEFAULT_RECORDS (1000000UL)
+#define LINE_SIZE (128)
+/*****************************************************************************/
+void CreateInput(size_t records);
+double BenchNaive(size_t *count);
+double BenchLoader(size_t *count);
+int FreeData(void *data, void *param);
+/*****************************************************************************/
+int main(int argc, char *argv[])
+{
+	size_t records = (1 < argc) ? strtoul(argv[1], NULL, 10) : DEFAULT_RECORDS;
+	size_t naive_count = 0;
+	size_t loader_count = 0;
+	double naive = 0;
+	double loader = 0;
+
+	CreateInput(records);
+	naive = BenchNaive(&naive_count);
+	loader = BenchLoader(&loader_count);
+	remove(PATH);
+
+	if(records != naive_count || records != loader_count)
+	{
+		puts("Number of loaded records mismatch.");
+		return 1;
+	}
+
+	printf("records          : %lu\n", (unsigned long)records);
+	printf("naive DLLPushBack: %.3f s\n", naive);
+	printf("DLLLoadFd        : %.3f s\n", loader);
+	printf("speedup          : %.2fx\n", loader > 0 ? naive / loader : 0.0);
+
+	return 0;
+}
+/*****************************************************************************/
+void CreateInput(size_t records)
+{
+	size_t i = 0;
+	FILE *file = fopen(PATH, "w");
+	assert(file);
+
+	for(; i < records; ++i)
+	{
+		fprintf(file, "record %lu of the benchmark input\n", (unsigned long)i);
+	}
+
+	fclose(file);
+}
+/*****************************************************************************/
+double BenchNaive(size_t *count)
+{
+	char line[LINE_SIZE];
+	clock_t start = clock();
+	dll_t *dll = DLLCreate();
+	FILE *file = fopen(PATH, "r");
+	size_t size = 0;
+	char *copy = NULL;
+
+	assert(dll && file);
+
+	while(fgets(line, LINE_SIZE, file))
+	{
+		size = strlen(line);
+		copy = (char *)malloc(size + 1);
+		assert(copy);
+		memcpy(copy, line, size + 1);
+		DLLPushBack(dll, copy);
+	}
+
+	fclose(file);
+	*count = DLLCount(dll);
+
+	DLLForEach(DLLBegin(dll), DLLEnd(dll), FreeData, NULL);
+	DLLDestroy(dll);
+
+	return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+/*****************************************************************************/
+double BenchLoader(size_t *count)
+{
+	clock_t start = clock();
+	int fd = open(PATH, O_RDONLY);
+	dll_load_t *load = NULL;
+
+	assert(-1 != fd);
+
+	load = DLLLoadFd(fd, DLL_LOAD_LINES);
+	close(fd);
+	assert(load);
+	*count = DLLCount(DLLLoadList(load));
+
+	DLLLoadDestroy(load);
+
+	return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+/*****************************************************************************/
+int FreeData(void *data, void *param)
+{
+	(void) param;
+	free(*(void **)data);
+	return 0;
+}
+/*****************************************************************************/
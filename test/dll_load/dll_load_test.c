@@ -0,0 +1,164 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This test file tests the streaming bulk loader of the doubly
+ *               linked list on mapped files and on pipes, in both formats.
+ * 
+******************************************************************************/
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>    /* printf, puts, remove */
+#include <string.h>   /* memcmp, strlen       */
+#include <assert.h>   /* assert    :)         */
+#include <fcntl.h>    /* open                 */
+#include <unistd.h>   /* write, close, pipe   */
+
+#include "dll.h"      /* Internal API         */
+#include "dll_load.h" /* Internal API         */
+/*****************************************************************************/
+#define PATH ("dll_load_test.txt")
+/*****************************************************************************/
+int WriteFile(const char *path, const void *content, size_t size);
+void CheckRecords(dll_load_t *load, const char **records, size_t count);
+void TestLines(void);
+void TestLengthPrefixed(void);
+void TestPipe(void);
+void TestMalformed(void);
+/*****************************************************************************/
+int main(void)
+{
+	TestLines();
+	TestLengthPrefixed();
+	TestPipe();
+	TestMalformed();
+
+	remove(PATH);
+	printf("\n\nDone!\n\n");
+	return 0;
+}
+/*****************************************************************************/
+void TestLines(void)
+{
+	const char content[] = "first\n\nthird line\nlast";
+	const char *records[] = {"first", "", "third line", "last"};
+	dll_load_t *load = NULL;
+	int fd = WriteFile(PATH, content, sizeof(content) - 1);
+
+	load = DLLLoadFd(fd, DLL_LOAD_LINES);
+	assert(load);
+	CheckRecords(load, records, 4);
+
+	/* The list may be modified, nodes point into the loader's buffer */
+	DLLPopFront(DLLLoadList(load));
+	CheckRecords(load, records + 1, 3);
+
+	DLLLoadDestroy(load);
+	close(fd);
+
+	fd = WriteFile(PATH, "last\n", 5);
+	load = DLLLoadFd(fd, DLL_LOAD_LINES);
+	assert(load);
+	CheckRecords(load, records + 3, 1);
+	assert(1 == DLLCount(DLLLoadList(load)));
+	DLLLoadDestroy(load);
+	close(fd);
+
+	fd = WriteFile(PATH, "", 0);
+	load = DLLLoadFd(fd, DLL_LOAD_LINES);
+	assert(load && DLLIsEmpty(DLLLoadList(load)));
+	DLLLoadDestroy(load);
+	close(fd);
+
+	puts("\nLoading lines from a file passed successfully.");
+}
+/*****************************************************************************/
+void TestLengthPrefixed(void)
+{
+	const char content[] = "\3\0\0\0abc\0\0\0\0\5\0\0\0a\nb\0c";
+	const char *records[] = {"abc", "", "a\nb\0c"};
+	dll_load_t *load = NULL;
+	dll_iter_t iter = NULL;
+	int fd = WriteFile(PATH, content, sizeof(content) - 1);
+
+	load = DLLLoadFd(fd, DLL_LOAD_LENGTH_PREFIXED);
+	assert(load);
+	assert(3 == DLLCount(DLLLoadList(load)));
+
+	iter = DLLPrev(DLLEnd(DLLLoadList(load)));
+	assert(5 == DLLLoadRecordSize(load, DLLGetData(iter)));
+	assert(0 == memcmp(records[2], DLLGetData(iter), 5));
+	CheckRecords(load, records, 2);
+
+	DLLLoadDestroy(load);
+	close(fd);
+	puts("\nLoading length-prefixed records passed successfully.");
+}
+/*****************************************************************************/
+void TestPipe(void)
+{
+	const char content[] = "a\nbb\nccc\n";
+	const char *records[] = {"a", "bb", "ccc"};
+	dll_load_t *load = NULL;
+	int fds[2] = {-1, -1};
+	int status = 0;
+	ssize_t written = 0;
+
+	status = pipe(fds);
+	assert(0 == status);
+	written = write(fds[1], content, sizeof(content) - 1);
+	assert(sizeof(content) - 1 == (size_t)written);
+	close(fds[1]);
+
+	load = DLLLoadFd(fds[0], DLL_LOAD_LINES);
+	assert(load);
+	CheckRecords(load, records, 3);
+
+	DLLLoadDestroy(load);
+	close(fds[0]);
+	puts("\nLoading lines from a pipe passed successfully.");
+}
+/*****************************************************************************/
+void TestMalformed(void)
+{
+	dll_load_t *load = NULL;
+	int fd = WriteFile(PATH, "\3\0\0\0ab", 6);
+
+	load = DLLLoadFd(fd, DLL_LOAD_LENGTH_PREFIXED);
+	assert(NULL == load);
+	close(fd);
+
+	fd = WriteFile(PATH, "\3\0", 2);
+	load = DLLLoadFd(fd, DLL_LOAD_LENGTH_PREFIXED);
+	assert(NULL == load);
+	close(fd);
+
+	puts("\nRejection of truncated records passed successfully.");
+}
+/*****************************************************************************/
+int WriteFile(const char *path, const void *content, size_t size)
+{
+	int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+	ssize_t written = 0;
+
+	assert(-1 != fd);
+	written = write(fd, content, size);
+	assert(size == (size_t)written);
+	lseek(fd, 0, SEEK_SET);
+
+	return (fd);
+}
+/*****************************************************************************/
+void CheckRecords(dll_load_t *load, const char **records, size_t count)
+{
+	size_t i = 0;
+	dll_t *dll = DLLLoadList(load);
+	dll_iter_t iter = DLLBegin(dll);
+
+	for(; i < count; ++i, iter = DLLNext(iter))
+	{
+		assert(!DLLIterIsEqual(iter, DLLEnd(dll)));
+		assert(strlen(records[i]) == DLLLoadRecordSize(load, DLLGetData(iter)));
+		assert(0 == memcmp(records[i], DLLGetData(iter), strlen(records[i])));
+	}
+}
+/*****************************************************************************/
@@ -0,0 +1,325 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This test file tests the serialization of the doubly linked list
+ *               and the memory-mapped snapshots of serialized files.
+ * 
+******************************************************************************/
+#include <stdio.h>         /* printf, puts, remove, FILE */
+#include <stdlib.h>        /* malloc, free               */
+#include <string.h>        /* memcpy, strlen, strcmp     */
+#include <assert.h>        /* assert    :)               */
+
+#include "dll.h"           /* Internal API               */
+#include "dll_serialize.h" /* Internal API               */
+/*****************************************************************************/
+#define PATH ("dll_serialize_test.bin")
+#define TEMP_PATH ("dll_serialize_test.bin.tmp")
+/*****************************************************************************/
+size_t EncodeSize(void *data, void *buffer, size_t capacity, void *param);
+int DecodeSize(const void *buffer, size_t size, void **data, void *param);
+int DecodeCopy(const void *buffer, size_t size, void **data, void *param);
+void ReleaseCopy(void *data, void *param);
+size_t EncodeString(void *data, void *buffer, size_t capacity, void *param);
+size_t EncodeFail(void *data, void *buffer, size_t capacity, void *param);
+void CorruptByte(const char *path, long offset);
+void TestRoundTrip(void);
+void TestEmpty(void);
+void TestSnapshot(void);
+void TestCorruption(void);
+void TestDecodeFailure(void);
+/*****************************************************************************/
+int main(void)
+{
+	TestRoundTrip();
+	TestEmpty();
+	TestSnapshot();
+	TestCorruption();
+	TestDecodeFailure();
+
+	remove(PATH);
+	printf("\n\nDone!\n\n");
+	return 0;
+}
+/*****************************************************************************/
+void TestRoundTrip(void)
+{
+	size_t i = 0;
+	int status = 0;
+	dll_t *dll = DLLCreate();
+	dll_t *copy = NULL;
+	dll_iter_t iter = NULL;
+	dll_snapshot_t *snapshot = NULL;
+
+	for(i = 0; i < 1000; ++i)
+	{
+		DLLPushBack(dll, (void *)(i * 7));
+	}
+
+	status = DLLSerialize(dll, PATH, EncodeSize, NULL);
+	assert(0 == status);
+	copy = DLLDeserialize(PATH, DecodeSize, NULL, NULL);
+	assert(copy);
+	assert(1000 == DLLCount(copy));
+
+	for(i = 0, iter = DLLBegin(copy); iter != DLLEnd(copy); ++i, iter = DLLNext(iter))
+	{
+		assert((void *)(i * 7) == DLLGetData(iter));
+	}
+
+	DLLDestroy(copy);
+
+	/* A failed write leaves the previous file, and no temporary file */
+	status = DLLSerialize(dll, PATH, EncodeFail, NULL);
+	assert(-1 == status);
+	snapshot = DLLSnapshotOpen(PATH, 1);
+	assert(snapshot);
+	assert(1000 == DLLSnapshotCount(snapshot));
+	assert(NULL == DLLSnapshotOpen(TEMP_PATH, 0));
+
+	DLLSnapshotClose(snapshot);
+	DLLDestroy(dll);
+	puts("\nSerialization round trip passed successfully.");
+}
+/*****************************************************************************/
+void TestEmpty(void)
+{
+	dll_t *dll = DLLCreate();
+	dll_t *copy = NULL;
+	dll_snapshot_t *snapshot = NULL;
+	int status = 0;
+
+	status = DLLSerialize(dll, PATH, EncodeSize, NULL);
+	assert(0 == status);
+	copy = DLLDeserialize(PATH, DecodeSize, NULL, NULL);
+	assert(copy && DLLIsEmpty(copy));
+
+	snapshot = DLLSnapshotOpen(PATH, 1);
+	assert(snapshot);
+	assert(0 == DLLSnapshotCount(snapshot));
+	assert(DLLSnapshotBegin(snapshot) == DLLSnapshotEnd(snapshot));
+	assert(NULL == DLLSnapshotNext(DLLSnapshotEnd(snapshot)));
+	assert(NULL == DLLSnapshotPrev(DLLSnapshotBegin(snapshot)));
+
+	DLLSnapshotClose(snapshot);
+	DLLDestroy(copy);
+	DLLDestroy(dll);
+	puts("\nSerialization of an empty list passed successfully.");
+}
+/*****************************************************************************/
+void TestSnapshot(void)
+{
+	/* Longer than the initial encoding buffer to force a second call */
+	static char longest[1000];
+	char *strings[] = {"", "a", "doubly", "linked list", NULL};
+	size_t i = 0;
+	size_t size = 0;
+	int status = 0;
+	dll_t *dll = DLLCreate();
+	dll_snapshot_t *snapshot = NULL;
+	dll_snap_iter_t iter = NULL;
+
+	memset(longest, 'x', sizeof(longest) - 1);
+	strings[4] = longest;
+
+	for(i = 0; i < 5; ++i)
+	{
+		DLLPushBack(dll, strings[i]);
+	}
+
+	status = DLLSerialize(dll, PATH, EncodeString, NULL);
+	assert(0 == status);
+	snapshot = DLLSnapshotOpen(PATH, 1);
+	assert(snapshot);
+	assert(5 == DLLSnapshotCount(snapshot));
+
+	/* Rewriting the file leaves the open snapshot on the old one */
+	DLLPushBack(dll, "replaced");
+	status = DLLSerialize(dll, PATH, EncodeString, NULL);
+	assert(0 == status);
+	DLLPopBack(dll);
+
+	for(i = 0, iter = DLLSnapshotBegin(snapshot); iter != DLLSnapshotEnd(snapshot);
+	    ++i, iter = DLLSnapshotNext(iter))
+	{
+		const char *data = (const char *)DLLSnapshotGetData(iter, &size);
+		assert(strlen(strings[i]) + 1 == size);
+		assert(0 == strcmp(strings[i], data));
+	}
+
+	assert(5 == i);
+
+	/* Walking backward from the end */
+	for(iter = DLLSnapshotPrev(DLLSnapshotEnd(snapshot)); iter; iter = DLLSnapshotPrev(iter))
+	{
+		--i;
+		assert(0 == strcmp(strings[i], (const char *)DLLSnapshotGetData(iter, NULL)));
+	}
+
+	assert(0 == i);
+
+	DLLSnapshotClose(snapshot);
+
+	snapshot = DLLSnapshotOpen(PATH, 1);
+	assert(snapshot);
+	assert(6 == DLLSnapshotCount(snapshot));
+
+	DLLSnapshotClose(snapshot);
+	DLLDestroy(dll);
+	puts("\nIteration of a snapshot passed successfully.");
+}
+/*****************************************************************************/
+void TestCorruption(void)
+{
+	size_t i = 0;
+	int status = 0;
+	dll_t *dll = DLLCreate();
+	dll_t *copy = NULL;
+	dll_snapshot_t *snapshot = NULL;
+
+	for(i = 0; i < 10; ++i)
+	{
+		DLLPushBack(dll, (void *)i);
+	}
+
+	status = DLLSerialize(dll, PATH, EncodeSize, NULL);
+	assert(0 == status);
+	CorruptByte(PATH, 88);
+
+	/* A payload byte is only caught by the checksum */
+	snapshot = DLLSnapshotOpen(PATH, 0);
+	assert(snapshot);
+	DLLSnapshotClose(snapshot);
+	assert(NULL == DLLSnapshotOpen(PATH, 1));
+	copy = DLLDeserialize(PATH, DecodeSize, NULL, NULL);
+	assert(NULL == copy);
+
+	status = DLLSerialize(dll, PATH, EncodeSize, NULL);
+	assert(0 == status);
+	CorruptByte(PATH, 0);
+	assert(NULL == DLLSnapshotOpen(PATH, 0));
+
+	assert(NULL == DLLSnapshotOpen("no_such_file.bin", 0));
+
+	DLLDestroy(dll);
+	puts("\nDetection of corrupted files passed successfully.");
+}
+/*****************************************************************************/
+void TestDecodeFailure(void)
+{
+	size_t i = 0;
+	size_t released = 0;
+	int status = 0;
+	dll_t *dll = DLLCreate();
+	dll_t *copy = NULL;
+
+	for(i = 0; i < 10; ++i)
+	{
+		DLLPushBack(dll, (void *)i);
+	}
+
+	status = DLLSerialize(dll, PATH, EncodeSize, NULL);
+	assert(0 == status);
+
+	/* The copies of the 5 records decoded before 5 are released */
+	copy = DLLDeserialize(PATH, DecodeCopy, ReleaseCopy, &released);
+	assert(NULL == copy);
+	assert(5 == released);
+
+	DLLDestroy(dll);
+	puts("\nRelease of decoded data on failure passed successfully.");
+}
+/*****************************************************************************/
+size_t EncodeSize(void *data, void *buffer, size_t capacity, void *param)
+{
+	(void) param;
+
+	if(capacity >= sizeof(size_t))
+	{
+		memcpy(buffer, &data, sizeof(size_t));
+	}
+
+	return (sizeof(size_t));
+}
+/*****************************************************************************/
+int DecodeSize(const void *buffer, size_t size, void **data, void *param)
+{
+	(void) param;
+
+	if(sizeof(size_t) != size)
+	{
+		return (-1);
+	}
+
+	memcpy(data, buffer, sizeof(size_t));
+	return (0);
+}
+/*****************************************************************************/
+int DecodeCopy(const void *buffer, size_t size, void **data, void *param)
+{
+	size_t *copy = NULL;
+	(void) param;
+
+	if(sizeof(size_t) != size)
+	{
+		return (-1);
+	}
+
+	copy = (size_t *)malloc(sizeof(size_t));
+	if(NULL == copy)
+	{
+		return (-1);
+	}
+
+	memcpy(copy, buffer, sizeof(size_t));
+	if(5 == *copy)
+	{
+		free(copy);
+		return (-1);
+	}
+
+	*data = copy;
+	return (0);
+}
+/*****************************************************************************/
+void ReleaseCopy(void *data, void *param)
+{
+	++*(size_t *)param;
+	free(data);
+}
+/*****************************************************************************/
+size_t EncodeString(void *data, void *buffer, size_t capacity, void *param)
+{
+	size_t size = strlen((char *)data) + 1;
+	(void) param;
+
+	if(capacity >= size)
+	{
+		memcpy(buffer, data, size);
+	}
+
+	return (size);
+}
+/*****************************************************************************/
+size_t EncodeFail(void *data, void *buffer, size_t capacity, void *param)
+{
+	(void) buffer;
+	(void) capacity;
+	(void) param;
+
+	return ((size_t)data == 500 * 7 ? (size_t)-1 : 0);
+}
+/*****************************************************************************/
+void CorruptByte(const char *path, long offset)
+{
+	int byte = 0;
+	FILE *file = fopen(path, "r+b");
+	assert(file);
+
+	fseek(file, offset, SEEK_SET);
+	byte = fgetc(file);
+	fseek(file, offset, SEEK_SET);
+	fputc(byte ^ 0xFF, file);
+	fclose(file);
+}
+/*****************************************************************************/
@@ -0,0 +1,168 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This benchmark compares threads pushing and popping through a
+ *               single list behind a single lock, taken and allocating a node
+ *               for every element, against a pool with a shard per thread.
+ *
+ *               Usage: dll_shard_bench [number of threads] [operations]
+ *
+******************************************************************************/
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>       /* printf               */
+#include <stdlib.h>      /* strtoul              */
+#include <time.h>        /* clock_gettime        */
+#include <pthread.h>     /* pthread_create       */
+
+#include "dll.h"         /* Internal API         */
+#include "dll_shard.h"   /* Internal API         */
+/*****************************************************************************/
+#define DEFAULT_THREADS (4UL)
+#define DEFAULT_OPERATIONS (1000000UL)
+#define MAX_THREADS (64)
+#define BATCH (16)
+
+typedef struct worker
+{
+	dll_t *dll;
+	pthread_mutex_t *lock;
+	dll_shard_t *pool;
+	size_t index;
+	size_t operations;
+	size_t sum;
+
+} worker_t;
+/*****************************************************************************/
+double Seconds(void);
+void *WorkLocked(void *param);
+void *WorkSharded(void *param);
+double Run(worker_t *workers, size_t threads, void *(*work)(void *), size_t *sum);
+/*****************************************************************************/
+int main(int argc, char *argv[])
+{
+	size_t threads = (1 < argc) ? strtoul(argv[1], NULL, 10) : DEFAULT_THREADS;
+	size_t operations = (2 < argc) ? strtoul(argv[2], NULL, 10) : DEFAULT_OPERATIONS;
+	static worker_t workers[MAX_THREADS];
+	pthread_mutex_t lock;
+	dll_t *dll = DLLCreate();
+	dll_shard_t *pool = NULL;
+	size_t locked_sum = 0;
+	size_t sharded_sum = 0;
+	double locked = 0;
+	double sharded = 0;
+	size_t i = 0;
+
+	threads = (0 == threads || MAX_THREADS < threads) ? DEFAULT_THREADS : threads;
+	pool = DLLShardCreate(threads, BATCH);
+	if(NULL == dll || NULL == pool || 0 != pthread_mutex_init(&lock, NULL))
+	{
+		return 1;
+	}
+
+	for(i = 0; i < threads; ++i)
+	{
+		workers[i].dll = dll;
+		workers[i].lock = &lock;
+		workers[i].pool = pool;
+		workers[i].index = i;
+		workers[i].operations = operations;
+	}
+
+	locked = Run(workers, threads, WorkLocked, &locked_sum);
+	sharded = Run(workers, threads, WorkSharded, &sharded_sum);
+
+	printf("%lu threads, %lu pushes and pops each\n", (unsigned long)threads, (unsigned long)operations);
+	printf("%-22s %12s %12s %12s\n", "", "locked list", "sharded", "checksum");
+	printf("%-22s %12.4f %12.4f %12s\n", "seconds", locked, sharded,
+	       (locked_sum == sharded_sum) ? "match" : "MISMATCH");
+
+	pthread_mutex_destroy(&lock);
+	DLLShardDestroy(pool);
+	DLLDestroy(dll);
+	return 0;
+}
+/*****************************************************************************/
+double Run(worker_t *workers, size_t threads, void *(*work)(void *), size_t *sum)
+{
+	static pthread_t ids[MAX_THREADS];
+	double start = Seconds();
+	size_t i = 0;
+
+	for(i = 0; i < threads; ++i)
+	{
+		workers[i].sum = 0;
+		if(0 != pthread_create(&ids[i], NULL, work, &workers[i]))
+		{
+			threads = i;
+		}
+	}
+
+	for(i = 0; i < threads; ++i)
+	{
+		pthread_join(ids[i], NULL);
+		*sum += workers[i].sum;
+	}
+
+	return (Seconds() - start);
+}
+/*****************************************************************************/
+void *WorkLocked(void *param)
+{
+	worker_t *worker = (worker_t *)param;
+	size_t done = 0;
+	size_t i = 0;
+
+	for(done = 0; done < worker->operations; done += BATCH)
+	{
+		for(i = 0; i < BATCH; ++i)
+		{
+			pthread_mutex_lock(worker->lock);
+			DLLPushBack(worker->dll, (void *)(done + i + 1));
+			pthread_mutex_unlock(worker->lock);
+		}
+
+		for(i = 0; i < BATCH; ++i)
+		{
+			pthread_mutex_lock(worker->lock);
+			worker->sum += (size_t)DLLPopBack(worker->dll);
+			pthread_mutex_unlock(worker->lock);
+		}
+	}
+
+	return (NULL);
+}
+/*****************************************************************************/
+void *WorkSharded(void *param)
+{
+	worker_t *worker = (worker_t *)param;
+	size_t done = 0;
+	size_t i = 0;
+
+	DLLShardBindThread(worker->index);
+
+	for(done = 0; done < worker->operations; done += BATCH)
+	{
+		for(i = 0; i < BATCH; ++i)
+		{
+			DLLShardPush(worker->pool, (void *)(done + i + 1));
+		}
+
+		for(i = 0; i < BATCH; ++i)
+		{
+			worker->sum += (size_t)DLLShardPop(worker->pool);
+		}
+	}
+
+	return (NULL);
+}
+/*****************************************************************************/
+double Seconds(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return ((double)now.tv_sec + (double)now.tv_nsec / 1e9);
+}
+/*****************************************************************************/
@@ -0,0 +1,270 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This test file tests the sharded pool: the order of popping
+ *               from the own shard and stealing from the others, the node
+ *               caches, the counts and actions over all the shards, and
+ *               threads pushing and popping concurrently.
+ *
+******************************************************************************/
+#include <stdio.h>         /* printf        */
+#include <assert.h>        /* assert    :)  */
+#include <pthread.h>       /* pthread_create */
+
+#include "dll_shard.h"     /* Internal API  */
+/*****************************************************************************/
+#define ITEMS (1000)
+#define THREADS (4)
+#define THREAD_ITEMS (20000)
+
+typedef struct worker
+{
+	dll_shard_t *pool;
+	size_t index;
+	size_t *items;
+	size_t popped;
+	size_t sum;
+
+} worker_t;
+/*****************************************************************************/
+int SumData(void *data, void *param);
+int StopAt(void *data, void *param);
+void *Work(void *param);
+void TestLocal(void);
+void TestSteal(void);
+void TestForEach(void);
+void TestThreads(void);
+/*****************************************************************************/
+int main(void)
+{
+	TestLocal();
+	TestSteal();
+	TestForEach();
+	TestThreads();
+
+	printf("\n\nDone!\n\n");
+	return 0;
+}
+/*****************************************************************************/
+void TestLocal(void)
+{
+	static size_t items[ITEMS];
+	dll_shard_t *pool = DLLShardCreate(4, 16);
+	void *data = NULL;
+	int status = 0;
+	size_t round = 0;
+	size_t i = 0;
+
+	assert(pool);
+	assert(DLLShardIsEmpty(pool));
+	data = DLLShardPop(pool);
+	assert(NULL == data);
+
+	DLLShardBindThread(0);
+
+	/* The second round runs on the nodes cached by the first */
+	for(round = 0; round < 2; ++round)
+	{
+		for(i = 0; i < ITEMS; ++i)
+		{
+			items[i] = i;
+			status = DLLShardPush(pool, &items[i]);
+			assert(0 == status);
+			assert(i + 1 == DLLShardCount(pool));
+		}
+
+		/* The own shard pops the last pushed first */
+		for(i = ITEMS; 0 < i; --i)
+		{
+			data = DLLShardPop(pool);
+			assert(&items[i - 1] == data);
+			assert(i - 1 == DLLShardCount(pool));
+		}
+
+		assert(DLLShardIsEmpty(pool));
+		data = DLLShardPop(pool);
+		assert(NULL == data);
+	}
+
+	DLLShardDestroy(pool);
+}
+/*****************************************************************************/
+void TestSteal(void)
+{
+	static size_t items[3 * ITEMS];
+	dll_shard_t *pool = DLLShardCreate(3, ITEMS);
+	void *data = NULL;
+	int status = 0;
+	size_t i = 0;
+
+	assert(pool);
+
+	/* Index 4 wraps to shard 1 */
+	for(i = 0; i < 3 * ITEMS; ++i)
+	{
+		items[i] = i;
+		DLLShardBindThread((i < ITEMS) ? 1 : (i < 2 * ITEMS) ? 2 : 0);
+		status = DLLShardPush(pool, &items[i]);
+		assert(0 == status);
+	}
+
+	assert(3 * ITEMS == DLLShardCount(pool));
+
+	DLLShardBindThread(4);
+
+	/* The own shard, newest first, then the next shards, oldest first */
+	for(i = ITEMS; 0 < i; --i)
+	{
+		data = DLLShardPop(pool);
+		assert(&items[i - 1] == data);
+	}
+
+	for(i = ITEMS; i < 3 * ITEMS; ++i)
+	{
+		data = DLLShardPop(pool);
+		assert(&items[i] == data);
+	}
+
+	assert(DLLShardIsEmpty(pool));
+	data = DLLShardPop(pool);
+	assert(NULL == data);
+
+	/* Stolen nodes are cached by the shard they were popped from */
+	DLLShardBindThread(2);
+	for(i = 0; i < ITEMS; ++i)
+	{
+		status = DLLShardPush(pool, &items[i]);
+		assert(0 == status);
+	}
+
+	assert(ITEMS == DLLShardCount(pool));
+
+	DLLShardDestroy(pool);
+}
+/*****************************************************************************/
+void TestForEach(void)
+{
+	static size_t items[ITEMS];
+	dll_shard_t *pool = DLLShardCreate(5, 0);
+	size_t stop = ITEMS / 2;
+	size_t sum = 0;
+	void *data = NULL;
+	int status = 0;
+	size_t i = 0;
+
+	assert(pool);
+
+	for(i = 0; i < ITEMS; ++i)
+	{
+		items[i] = i;
+		DLLShardBindThread(i);
+		status = DLLShardPush(pool, &items[i]);
+		assert(0 == status);
+	}
+
+	assert(ITEMS == DLLShardCount(pool));
+	status = DLLShardForEach(pool, SumData, &sum);
+	assert(0 == status);
+	assert(ITEMS * (ITEMS - 1) / 2 == sum);
+
+	status = DLLShardForEach(pool, StopAt, &stop);
+	assert(1 == status);
+
+	/* Without a cache every pop frees its node */
+	for(i = 0; i < ITEMS; ++i)
+	{
+		data = DLLShardPop(pool);
+		assert(NULL != data);
+	}
+
+	assert(DLLShardIsEmpty(pool));
+	status = DLLShardForEach(pool, StopAt, &stop);
+	assert(0 == status);
+
+	DLLShardDestroy(pool);
+}
+/*****************************************************************************/
+void TestThreads(void)
+{
+	static size_t items[THREADS][THREAD_ITEMS];
+	pthread_t threads[THREADS];
+	worker_t workers[THREADS];
+	dll_shard_t *pool = DLLShardCreate(2, 64);
+	size_t popped = 0;
+	size_t sum = 0;
+	int status = 0;
+	size_t i = 0;
+
+	assert(pool);
+
+	for(i = 0; i < THREADS; ++i)
+	{
+		workers[i].pool = pool;
+		workers[i].index = i;
+		workers[i].items = items[i];
+		workers[i].popped = 0;
+		workers[i].sum = 0;
+		status = pthread_create(&threads[i], NULL, Work, &workers[i]);
+		assert(0 == status);
+	}
+
+	for(i = 0; i < THREADS; ++i)
+	{
+		status = pthread_join(threads[i], NULL);
+		assert(0 == status);
+		popped += workers[i].popped;
+		sum += workers[i].sum;
+	}
+
+	/* What the workers left is still in the pool */
+	status = DLLShardForEach(pool, SumData, &sum);
+	assert(0 == status);
+	popped += DLLShardCount(pool);
+
+	assert(THREADS * THREAD_ITEMS == popped);
+	assert(THREADS * ((size_t)THREAD_ITEMS * (THREAD_ITEMS - 1) / 2) == sum);
+
+	DLLShardDestroy(pool);
+}
+/*****************************************************************************/
+void *Work(void *param)
+{
+	worker_t *worker = (worker_t *)param;
+	size_t *data = NULL;
+	size_t pops = 0;
+	int status = 0;
+	size_t i = 0;
+
+	DLLShardBindThread(worker->index);
+
+	for(i = 0; i < THREAD_ITEMS; ++i)
+	{
+		worker->items[i] = i;
+		status = DLLShardPush(worker->pool, &worker->items[i]);
+		assert(0 == status);
+
+		/* Even workers pop every other push, odd ones twice a push and steal */
+		for(pops = (worker->index % 2) ? 2 : (i % 2); 0 < pops; --pops)
+		{
+			if(NULL != (data = DLLShardPop(worker->pool)))
+			{
+				++worker->popped;
+				worker->sum += *data;
+			}
+		}
+	}
+
+	return (NULL);
+}
+/*****************************************************************************/
+int SumData(void *data, void *param)
+{
+	*(size_t *)param += **(size_t **)data;
+	return (0);
+}
+/*****************************************************************************/
+int StopAt(void *data, void *param)
+{
+	return (**(size_t **)data == *(size_t *)param);
+}
+/*****************************************************************************/
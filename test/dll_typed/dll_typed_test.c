@@ -0,0 +1,266 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This test file tests the type-specialized lists generated by
+ *               DLL_DECLARE against the semantics of the void * list in dll.h.
+ * 
+******************************************************************************/
+#include <stdio.h>     /* printf, puts  */
+#include <assert.h>    /* assert    :)  */
+
+#include "dll_typed.h" /* Internal API  */
+/*****************************************************************************/
+typedef struct point
+{
+	int x;
+	int y;
+
+} point_t;
+
+#define IS_ODD(data, param) (*(data) % 2)
+
+DLL_DECLARE(intlist, int)
+DLL_DECLARE(pointlist, point_t)
+/*****************************************************************************/
+int CmpInt(const int *data, void *param);
+int AddInt(int *data, void *param);
+int CmpPointX(const point_t *data, void *param);
+int AddPoint(point_t *data, void *param);
+DLL_DECLARE_FIND(intlist, intlistFindEven, IS_ODD)
+DLL_DECLARE_FOREACH(pointlist, pointlistShift, AddPoint)
+void TestCreate(void);
+void TestInsertRemove(void);
+void TestPushPop(void);
+void TestForEachFind(void);
+void TestSplice(void);
+void TestStruct(void);
+/*****************************************************************************/
+int main(void)
+{
+	TestCreate();
+	TestInsertRemove();
+	TestPushPop();
+	TestForEachFind();
+	TestSplice();
+	TestStruct();
+
+	printf("\n\nDone!\n\n");
+	return 0;
+}
+/*****************************************************************************/
+void TestCreate(void)
+{
+	intlist_t *list = intlistCreate();
+
+	assert(list);
+	assert(intlistIsEmpty(list));
+	assert(0 == intlistCount(list));
+	assert(intlistIterIsEqual(intlistBegin(list), intlistEnd(list)));
+	assert(NULL == intlistNext(intlistEnd(list)));
+
+	intlistDestroy(list);
+	puts("\nCreation of typed list passed successfully.");
+}
+/*****************************************************************************/
+void TestInsertRemove(void)
+{
+	int i = 0;
+	intlist_t *list = intlistCreate();
+	intlist_iter_t iter = intlistBegin(list);
+	intlist_iter_t first = NULL;
+
+	iter = intlistInsertBefore(iter, 0);
+	first = iter;
+
+	for(i = 1; 10 > i; ++i)
+	{
+		iter = intlistInsertAfter(iter, i);
+		assert(i == intlistGetData(iter));
+	}
+
+	assert(10 == intlistCount(list));
+	assert(first == intlistBegin(list));
+
+	for(i = 0, iter = intlistBegin(list); 10 > i; ++i)
+	{
+		assert(i == intlistGetData(iter));
+		iter = intlistNext(iter);
+	}
+
+	/* Removing returns the next element and keeps other iterators valid */
+	iter = intlistRemove(intlistNext(first));
+	assert(2 == intlistGetData(iter));
+	assert(0 == intlistGetData(first));
+	assert(iter == intlistNext(first));
+
+	intlistSetData(iter, 100);
+	assert(100 == intlistGetData(intlistNext(intlistBegin(list))));
+	assert(9 == intlistCount(list));
+
+	intlistDestroy(list);
+	puts("\nInsert and remove of typed list passed successfully.");
+}
+/*****************************************************************************/
+void TestPushPop(void)
+{
+	int i = 0;
+	int back = 0;
+	int front = 0;
+	intlist_t *list = intlistCreate();
+
+	for(i = 0; 5 > i; ++i)
+	{
+		intlistPushBack(list, i);
+		intlistPushFront(list, -i);
+	}
+
+	assert(10 == intlistCount(list));
+	back = intlistPopBack(list);
+	front = intlistPopFront(list);
+	assert(4 == back);
+	assert(-4 == front);
+	assert(3 == intlistGetData(intlistPrev(intlistEnd(list))));
+	assert(-3 == intlistGetData(intlistBegin(list)));
+
+	while(!intlistIsEmpty(list))
+	{
+		intlistPopFront(list);
+	}
+
+	assert(0 == intlistCount(list));
+	intlistDestroy(list);
+	puts("\nPush and pop of typed list passed successfully.");
+}
+/*****************************************************************************/
+void TestForEachFind(void)
+{
+	int i = 0;
+	int add = 3;
+	int status = 0;
+	int matches = 0;
+	intlist_t *list = intlistCreate();
+	intlist_t *dest = intlistCreate();
+	intlist_iter_t found = NULL;
+
+	for(i = 1; 10 > i; ++i)
+	{
+		intlistPushBack(list, i);
+	}
+
+	status = intlistForEach(intlistBegin(list), intlistEnd(list), AddInt, &add);
+	assert(0 == status);
+	assert(4 == intlistGetData(intlistBegin(list)));
+
+	i = 8;
+	found = intlistFind(intlistBegin(list), intlistEnd(list), CmpInt, &i);
+	assert(8 == intlistGetData(found));
+
+	i = 100;
+	found = intlistFind(intlistBegin(list), intlistEnd(list), CmpInt, &i);
+	assert(intlistIterIsEqual(found, intlistEnd(list)));
+
+	found = intlistFindEven(intlistBegin(list), intlistEnd(list), NULL);
+	assert(4 == intlistGetData(found));
+
+	i = 8;
+	matches = intlistMultiFind(intlistBegin(list), intlistEnd(list), CmpInt, &i, dest);
+	assert(1 == matches);
+	assert(8 == intlistGetData(intlistBegin(dest)));
+
+	intlistDestroy(dest);
+	intlistDestroy(list);
+	puts("\nFor each and find of typed list passed successfully.");
+}
+/*****************************************************************************/
+void TestSplice(void)
+{
+	int i = 0;
+	intlist_t *list1 = intlistCreate();
+	intlist_t *list2 = intlistCreate();
+	intlist_iter_t iter = NULL;
+
+	for(i = 0; 5 > i; ++i)
+	{
+		intlistPushBack(list1, i);
+		intlistPushBack(list2, i + 10);
+	}
+
+	/* Moving {11, 12, 13} before 2 */
+	intlistSplice(intlistNext(intlistNext(intlistBegin(list1))),
+	              intlistNext(intlistBegin(list2)), intlistPrev(intlistEnd(list2)));
+
+	assert(8 == intlistCount(list1));
+	assert(2 == intlistCount(list2));
+
+	{
+		int expected[] = {0, 1, 11, 12, 13, 2, 3, 4};
+		for(i = 0, iter = intlistBegin(list1); 8 > i; ++i, iter = intlistNext(iter))
+		{
+			assert(expected[i] == intlistGetData(iter));
+		}
+	}
+
+	intlistSplice(intlistEnd(list2), intlistBegin(list1), intlistEnd(list1));
+	assert(intlistIsEmpty(list1));
+	assert(10 == intlistCount(list2));
+	assert(4 == intlistGetData(intlistPrev(intlistEnd(list2))));
+
+	intlistDestroy(list1);
+	intlistDestroy(list2);
+	puts("\nSplice of typed list passed successfully.");
+}
+/*****************************************************************************/
+void TestStruct(void)
+{
+	int i = 0;
+	pointlist_t *list = pointlistCreate();
+	point_t point = {0, 0};
+	point_t shift = {1, 2};
+	pointlist_iter_t found = NULL;
+	int status = 0;
+
+	for(i = 0; 10 > i; ++i)
+	{
+		point.x = i;
+		point.y = -i;
+		pointlistPushBack(list, point);
+	}
+
+	status = pointlistShift(pointlistBegin(list), pointlistEnd(list), &shift);
+	assert(0 == status);
+
+	i = 5;
+	found = pointlistFind(pointlistBegin(list), pointlistEnd(list), CmpPointX, &i);
+	point = pointlistGetData(found);
+	assert(5 == point.x && -2 == point.y);
+
+	point = pointlistPopBack(list);
+	assert(10 == point.x && -7 == point.y);
+
+	pointlistDestroy(list);
+	puts("\nStruct payload of typed list passed successfully.");
+}
+/*****************************************************************************/
+int CmpInt(const int *data, void *param)
+{
+	return (*data - *(int *)param);
+}
+/*****************************************************************************/
+int AddInt(int *data, void *param)
+{
+	*data += *(int *)param;
+	return 0;
+}
+/*****************************************************************************/
+int CmpPointX(const point_t *data, void *param)
+{
+	return (data->x - *(int *)param);
+}
+/*****************************************************************************/
+int AddPoint(point_t *data, void *param)
+{
+	data->x += ((point_t *)param)->x;
+	data->y += ((point_t *)param)->y;
+	return 0;
+}
+/*****************************************************************************/
@@ -0,0 +1,127 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This benchmark compares a view pipeline with DLLMultiFind for
+ *               consuming the first matches of a large list, and all of them.
+ *
+ *               Usage: dll_view_bench [number of elements]
+ * 
+******************************************************************************/
+#include <stdio.h>       /* printf               */
+#include <stdlib.h>      /* strtoul              */
+#include <time.h>        /* clock                */
+
+#include "dll.h"         /* Internal API         */
+#include "dll_view.h"    /* Internal API         */
+/*****************************************************************************/
+#define DEFAULT_ELEMENTS (1000000UL)
+#define FIRST (10)
+#define ROUNDS (20)
+#define SECONDS(start) ((double)(clock() - (start)) / CLOCKS_PER_SEC)
+/*****************************************************************************/
+int IsOdd(void *data, void *param);
+void *Square(void *data, void *param);
+size_t ByMultiFind(dll_t *dll, size_t first);
+size_t ByView(dll_t *dll, size_t first);
+void Bench(dll_t *dll, size_t first, const char *title);
+/*****************************************************************************/
+int main(int argc, char *argv[])
+{
+	size_t elements = (1 < argc) ? strtoul(argv[1], NULL, 10) : DEFAULT_ELEMENTS;
+	dll_t *dll = DLLCreate();
+	size_t i = 0;
+
+	if(NULL == dll)
+	{
+		return 1;
+	}
+
+	for(i = 0; i < elements; ++i)
+	{
+		DLLPushBack(dll, (void *)i);
+	}
+
+	printf("%-22s %12s %12s %12s\n", "", "multi find", "view", "checksum");
+	Bench(dll, FIRST, "first 10 matches");
+	Bench(dll, (size_t)-1, "all matches");
+
+	DLLDestroy(dll);
+	return 0;
+}
+/*****************************************************************************/
+void Bench(dll_t *dll, size_t first, const char *title)
+{
+	size_t round = 0;
+	size_t by_find = 0;
+	size_t by_view = 0;
+	clock_t start = clock();
+	double find_time = 0;
+
+	for(round = 0; round < ROUNDS; ++round)
+	{
+		by_find += ByMultiFind(dll, first);
+	}
+
+	find_time = SECONDS(start);
+	start = clock();
+
+	for(round = 0; round < ROUNDS; ++round)
+	{
+		by_view += ByView(dll, first);
+	}
+
+	printf("%-22s %12.4f %12.4f %12s\n", title, find_time, SECONDS(start),
+	       (by_find == by_view) ? "match" : "MISMATCH");
+}
+/*****************************************************************************/
+size_t ByMultiFind(dll_t *dll, size_t first)
+{
+	dll_t *found = DLLCreate();
+	dll_iter_t iter = NULL;
+	size_t sum = 0;
+
+	DLLMultiFind(DLLBegin(dll), DLLEnd(dll), IsOdd, NULL, found);
+
+	for(iter = DLLBegin(found); 0 < first && !DLLIterIsEqual(iter, DLLEnd(found)); --first)
+	{
+		sum += (size_t)Square(DLLGetData((dll_iter_t)DLLGetData(iter)), NULL);
+		iter = DLLNext(iter);
+	}
+
+	DLLDestroy(found);
+	return (sum);
+}
+/*****************************************************************************/
+size_t ByView(dll_t *dll, size_t first)
+{
+	dll_view_t range;
+	dll_view_t filter;
+	dll_view_t map;
+	dll_view_t take;
+	void *data = NULL;
+	size_t sum = 0;
+
+	DLLViewRange(&range, DLLBegin(dll), DLLEnd(dll));
+	DLLViewFilter(&filter, &range, IsOdd, NULL);
+	DLLViewTake(&take, DLLViewMap(&map, &filter, Square, NULL), first);
+
+	while(DLLViewNext(&take, &data))
+	{
+		sum += (size_t)data;
+	}
+
+	return (sum);
+}
+/*****************************************************************************/
+int IsOdd(void *data, void *param)
+{
+	(void) param;
+	return (0 == (size_t)data % 2);
+}
+/*****************************************************************************/
+void *Square(void *data, void *param)
+{
+	(void) param;
+	return ((void *)((size_t)data * (size_t)data));
+}
+/*****************************************************************************/
@@ -0,0 +1,231 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This test file tests the lazy views: each kind of view alone,
+ *               pipelines of them, and that a pipeline touches no more nodes
+ *               than it needs.
+ * 
+******************************************************************************/
+#include <stdio.h>         /* printf, puts  */
+#include <assert.h>        /* assert    :)  */
+
+#include "dll.h"           /* Internal API  */
+#include "dll_view.h"      /* Internal API  */
+/*****************************************************************************/
+#define ELEMENTS (1000)
+
+typedef struct counted
+{
+	size_t modulo;
+	size_t calls;
+
+} counted_t;
+/*****************************************************************************/
+dll_t *CreateList(size_t count);
+int IsMultiple(void *data, void *param);
+void *Double(void *data, void *param);
+void TestRange(void);
+void TestSingleViews(void);
+void TestPipeline(void);
+void TestMultiFind(void);
+/*****************************************************************************/
+int main(void)
+{
+	TestRange();
+	TestSingleViews();
+	TestPipeline();
+	TestMultiFind();
+
+	printf("\n\nDone!\n\n");
+	return 0;
+}
+/*****************************************************************************/
+dll_t *CreateList(size_t count)
+{
+	dll_t *dll = DLLCreate();
+	size_t i = 0;
+
+	assert(dll);
+	for(i = 0; i < count; ++i)
+	{
+		DLLPushBack(dll, (void *)i);
+	}
+
+	return (dll);
+}
+/*****************************************************************************/
+void TestRange(void)
+{
+	dll_t *dll = CreateList(ELEMENTS);
+	dll_view_t range;
+	void *data = NULL;
+	int has_next = 0;
+	size_t i = 0;
+
+	DLLViewRange(&range, DLLBegin(dll), DLLEnd(dll));
+	for(i = 0; DLLViewNext(&range, &data); ++i)
+	{
+		assert(i == (size_t)data);
+	}
+
+	assert(ELEMENTS == i);
+	has_next = DLLViewNext(&range, &data);
+	assert(!has_next);
+
+	/* An empty range */
+	DLLViewRange(&range, DLLEnd(dll), DLLEnd(dll));
+	has_next = DLLViewNext(&range, &data);
+	assert(!has_next);
+
+	DLLDestroy(dll);
+	puts("\nRange views passed successfully.");
+}
+/*****************************************************************************/
+void TestSingleViews(void)
+{
+	dll_t *dll = CreateList(ELEMENTS);
+	counted_t counted = {3, 0};
+	dll_view_t range;
+	dll_view_t view;
+	void *data = NULL;
+	int has_next = 0;
+	size_t i = 0;
+
+	DLLViewFilter(&view, DLLViewRange(&range, DLLBegin(dll), DLLEnd(dll)), IsMultiple, &counted);
+	for(i = 0; DLLViewNext(&view, &data); i += 3)
+	{
+		assert(i == (size_t)data);
+	}
+
+	assert(1002 == i);
+	assert(ELEMENTS == counted.calls);
+
+	DLLViewMap(&view, DLLViewRange(&range, DLLBegin(dll), DLLEnd(dll)), Double, NULL);
+	for(i = 0; DLLViewNext(&view, &data); ++i)
+	{
+		assert(2 * i == (size_t)data);
+	}
+
+	assert(ELEMENTS == i);
+
+	DLLViewTake(&view, DLLViewRange(&range, DLLBegin(dll), DLLEnd(dll)), 5);
+	for(i = 0; DLLViewNext(&view, &data); ++i)
+	{
+		assert(i == (size_t)data);
+	}
+
+	assert(5 == i);
+	assert(5 == (size_t)DLLGetData(range.position));
+
+	DLLViewSkip(&view, DLLViewRange(&range, DLLBegin(dll), DLLEnd(dll)), 990);
+	for(i = 990; DLLViewNext(&view, &data); ++i)
+	{
+		assert(i == (size_t)data);
+	}
+
+	assert(ELEMENTS == i);
+
+	/* Taking or skipping more than there is */
+	DLLViewTake(&view, DLLViewRange(&range, DLLBegin(dll), DLLEnd(dll)), 2 * ELEMENTS);
+	for(i = 0; DLLViewNext(&view, &data); ++i)
+	{
+	}
+
+	assert(ELEMENTS == i);
+
+	DLLViewSkip(&view, DLLViewRange(&range, DLLBegin(dll), DLLEnd(dll)), 2 * ELEMENTS);
+	has_next = DLLViewNext(&view, &data);
+	assert(!has_next);
+
+	DLLDestroy(dll);
+	puts("\nFilter, map, take and skip views passed successfully.");
+}
+/*****************************************************************************/
+void TestPipeline(void)
+{
+	dll_t *dll = CreateList(ELEMENTS);
+	counted_t even = {2, 0};
+	counted_t by_six = {6, 0};
+	dll_view_t views[6];
+	dll_view_t *pipeline = NULL;
+	void *data = NULL;
+	size_t i = 0;
+
+	/* The doubles of the first 10 even numbers from 10 */
+	pipeline = DLLViewRange(&views[0], DLLBegin(dll), DLLEnd(dll));
+	pipeline = DLLViewSkip(&views[1], pipeline, 10);
+	pipeline = DLLViewFilter(&views[2], pipeline, IsMultiple, &even);
+	pipeline = DLLViewMap(&views[3], pipeline, Double, NULL);
+	pipeline = DLLViewTake(&views[4], pipeline, 10);
+
+	for(i = 10; DLLViewNext(pipeline, &data); i += 2)
+	{
+		assert(2 * i == (size_t)data);
+	}
+
+	/* The predicate ran on 10 to 28 only, no node after 28 was touched */
+	assert(30 == i);
+	assert(19 == even.calls);
+	assert(29 == (size_t)DLLGetData(views[0].position));
+
+	/* Filters of a filter, and of a map */
+	even.calls = 0;
+	pipeline = DLLViewRange(&views[0], DLLBegin(dll), DLLEnd(dll));
+	pipeline = DLLViewFilter(&views[1], pipeline, IsMultiple, &even);
+	pipeline = DLLViewMap(&views[2], pipeline, Double, NULL);
+	pipeline = DLLViewFilter(&views[3], pipeline, IsMultiple, &by_six);
+	pipeline = DLLViewTake(&views[4], pipeline, 3);
+
+	for(i = 0; DLLViewNext(pipeline, &data); ++i)
+	{
+		assert(12 * i == (size_t)data);
+	}
+
+	assert(3 == i);
+	assert(7 == by_six.calls);
+
+	DLLDestroy(dll);
+	puts("\nPipelines passed successfully.");
+}
+/*****************************************************************************/
+void TestMultiFind(void)
+{
+	dll_t *dll = CreateList(ELEMENTS);
+	dll_t *found = DLLCreate();
+	counted_t counted = {7, 0};
+	dll_view_t range;
+	dll_view_t filter;
+	dll_iter_t iter = NULL;
+	void *data = NULL;
+
+	DLLMultiFind(DLLBegin(dll), DLLEnd(dll), IsMultiple, &counted, found);
+	DLLViewFilter(&filter, DLLViewRange(&range, DLLBegin(dll), DLLEnd(dll)), IsMultiple, &counted);
+
+	/* The filter yields the data of the iterators DLLMultiFind collects */
+	for(iter = DLLBegin(found); DLLViewNext(&filter, &data); iter = DLLNext(iter))
+	{
+		assert(!DLLIterIsEqual(iter, DLLEnd(found)));
+		assert(DLLGetData((dll_iter_t)DLLGetData(iter)) == data);
+	}
+
+	assert(DLLIterIsEqual(iter, DLLEnd(found)));
+
+	DLLDestroy(found);
+	DLLDestroy(dll);
+	puts("\nFilters match DLLMultiFind passed successfully.");
+}
+/*****************************************************************************/
+int IsMultiple(void *data, void *param)
+{
+	counted_t *counted = (counted_t *)param;
+
+	++counted->calls;
+	return ((int)((size_t)data % counted->modulo));
+}
+/*****************************************************************************/
+void *Double(void *data, void *param)
+{
+	(void) param;
+	return ((void *)(2 * (size_t)data));
+}
+/*****************************************************************************/
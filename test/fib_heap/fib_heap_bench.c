@@ -0,0 +1,120 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This benchmark compares the Fibonacci heap with a sorted list
+ *               kept by DLLFind and DLLInsertBefore, inserting random keys and
+ *               popping them all.
+ *
+ *               Usage: fib_heap_bench [number of keys]
+ * 
+******************************************************************************/
+#include <stdio.h>       /* printf               */
+#include <stdlib.h>      /* strtoul, rand        */
+#include <time.h>        /* clock                */
+
+#include "dll.h"         /* Internal API         */
+#include "fib_heap.h"    /* Internal API         */
+/*****************************************************************************/
+#define DEFAULT_KEYS (20000UL)
+#define SECONDS(start) ((double)(clock() - (start)) / CLOCKS_PER_SEC)
+/*****************************************************************************/
+int CmpKeys(void *data, void *param);
+int IsAfter(void *data, void *param);
+void BenchHeap(size_t keys);
+void BenchSorted(size_t keys);
+/*****************************************************************************/
+int main(int argc, char *argv[])
+{
+	size_t keys = (1 < argc) ? strtoul(argv[1], NULL, 10) : DEFAULT_KEYS;
+
+	printf("%-26s %10s %10s %10s\n", "", "insert", "pop", "checksum");
+	BenchHeap(keys);
+	BenchSorted(keys);
+
+	return 0;
+}
+/*****************************************************************************/
+void BenchHeap(size_t keys)
+{
+	char title[64];
+	size_t i = 0;
+	size_t checksum = 0;
+	fib_heap_t *heap = FibHeapCreate(CmpKeys);
+	clock_t start = clock();
+	double insert = 0;
+
+	if(NULL == heap)
+	{
+		return;
+	}
+
+	srand(42);
+	for(i = 0; i < keys; ++i)
+	{
+		FibHeapInsert(heap, (void *)(1 + (size_t)rand()));
+	}
+
+	insert = SECONDS(start);
+	start = clock();
+
+	for(i = 1; !FibHeapIsEmpty(heap); ++i)
+	{
+		checksum += i * (size_t)FibHeapPop(heap);
+	}
+
+	sprintf(title, "fib heap, %lu keys", (unsigned long)keys);
+	printf("%-26s %10.3f %10.3f %10lu\n", title, insert, SECONDS(start),
+	       (unsigned long)checksum);
+
+	FibHeapDestroy(heap);
+}
+/*****************************************************************************/
+void BenchSorted(size_t keys)
+{
+	char title[64];
+	size_t i = 0;
+	size_t checksum = 0;
+	dll_t *dll = DLLCreate();
+	dll_iter_t iter = NULL;
+	clock_t start = clock();
+	double insert = 0;
+
+	if(NULL == dll)
+	{
+		return;
+	}
+
+	srand(42);
+	for(i = 0; i < keys; ++i)
+	{
+		void *key = (void *)(1 + (size_t)rand());
+
+		iter = DLLFind(DLLBegin(dll), DLLEnd(dll), IsAfter, key);
+		DLLInsertBefore(iter, key);
+	}
+
+	insert = SECONDS(start);
+	start = clock();
+
+	for(i = 1; !DLLIsEmpty(dll); ++i)
+	{
+		checksum += i * (size_t)DLLPopFront(dll);
+	}
+
+	sprintf(title, "sorted list, %lu keys", (unsigned long)keys);
+	printf("%-26s %10.3f %10.3f %10lu\n", title, insert, SECONDS(start),
+	       (unsigned long)checksum);
+
+	DLLDestroy(dll);
+}
+/*****************************************************************************/
+int CmpKeys(void *data, void *param)
+{
+	return ((data > param) - (data < param));
+}
+/*****************************************************************************/
+int IsAfter(void *data, void *param)
+{
+	return (data <= param);
+}
+/*****************************************************************************/
@@ -0,0 +1,271 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This test file tests the Fibonacci heap: pop order, melding,
+ *               decreasing keys and removing through handles, and a random mix
+ *               of operations checked against a plain array.
+ * 
+******************************************************************************/
+#include <stdio.h>         /* printf, puts  */
+#include <stdlib.h>        /* rand, srand   */
+#include <assert.h>        /* assert    :)  */
+
+#include "fib_heap.h"      /* Internal API  */
+/*****************************************************************************/
+#define ORDER_ITEMS (1000)
+#define RANDOM_ITEMS (5000)
+#define RANDOM_STEPS (50000)
+
+typedef struct item
+{
+	size_t key;
+	fib_handle_t *handle;
+	int is_live;
+
+} item_t;
+/*****************************************************************************/
+int CmpItems(void *data, void *param);
+void TestOrder(void);
+void TestMeld(void);
+void TestDecreaseKey(void);
+void TestRandom(void);
+/*****************************************************************************/
+int main(void)
+{
+	TestOrder();
+	TestMeld();
+	TestDecreaseKey();
+	TestRandom();
+
+	printf("\n\nDone!\n\n");
+	return 0;
+}
+/*****************************************************************************/
+void TestOrder(void)
+{
+	static item_t items[ORDER_ITEMS];
+	fib_heap_t *heap = FibHeapCreate(CmpItems);
+	item_t *item = NULL;
+	void *data = NULL;
+	size_t last = 0;
+	size_t i = 0;
+
+	assert(heap);
+	assert(FibHeapIsEmpty(heap));
+
+	srand(42);
+	for(i = 0; i < ORDER_ITEMS; ++i)
+	{
+		/* Many equal keys */
+		items[i].key = (size_t)rand() % (ORDER_ITEMS / 4);
+		items[i].handle = FibHeapInsert(heap, &items[i]);
+		assert(items[i].handle);
+		assert(&items[i] == FibHeapGetData(items[i].handle));
+	}
+
+	assert(ORDER_ITEMS == FibHeapSize(heap));
+	assert(!FibHeapIsEmpty(heap));
+
+	for(i = 0; i < ORDER_ITEMS; ++i)
+	{
+		item = (item_t *)FibHeapPeek(heap);
+		data = FibHeapPop(heap);
+		assert(item == data);
+		assert(last <= item->key);
+		last = item->key;
+	}
+
+	assert(FibHeapIsEmpty(heap));
+
+	/* Elements left in the heap are freed on destroy */
+	FibHeapInsert(heap, &items[0]);
+	FibHeapInsert(heap, &items[1]);
+	FibHeapInsert(heap, &items[2]);
+	FibHeapPop(heap);
+	FibHeapDestroy(heap);
+	puts("\nPop order passed successfully.");
+}
+/*****************************************************************************/
+void TestMeld(void)
+{
+	item_t items[20];
+	fib_heap_t *heap = FibHeapCreate(CmpItems);
+	fib_heap_t *other = FibHeapCreate(CmpItems);
+	fib_heap_t *empty = FibHeapCreate(CmpItems);
+	void *data = NULL;
+	size_t i = 0;
+
+	for(i = 0; i < 20; ++i)
+	{
+		items[i].key = i;
+		items[i].handle = FibHeapInsert((i % 2) ? heap : other, &items[i]);
+	}
+
+	/* Giving both heaps children before melding */
+	data = FibHeapPop(heap);
+	assert(&items[1] == data);
+	data = FibHeapPop(other);
+	assert(&items[0] == data);
+
+	FibHeapMeld(heap, empty);
+	assert(9 == FibHeapSize(heap));
+
+	FibHeapMeld(heap, other);
+	assert(18 == FibHeapSize(heap));
+
+	/* Handles of the melded heap still work */
+	items[19].key = 0;
+	FibHeapDecreaseKey(heap, items[19].handle, &items[19]);
+	data = FibHeapPop(heap);
+	assert(&items[19] == data);
+
+	for(i = 2; i < 19; ++i)
+	{
+		data = FibHeapPop(heap);
+		assert(&items[i] == data);
+	}
+
+	assert(FibHeapIsEmpty(heap));
+
+	empty = FibHeapCreate(CmpItems);
+	FibHeapInsert(empty, &items[5]);
+	FibHeapMeld(heap, empty);
+	assert(&items[5] == FibHeapPeek(heap));
+
+	FibHeapDestroy(heap);
+	puts("\nMelding heaps passed successfully.");
+}
+/*****************************************************************************/
+void TestDecreaseKey(void)
+{
+	static item_t items[ORDER_ITEMS];
+	fib_heap_t *heap = FibHeapCreate(CmpItems);
+	void *data = NULL;
+	size_t i = 0;
+
+	for(i = 0; i < ORDER_ITEMS; ++i)
+	{
+		items[i].key = ORDER_ITEMS + i;
+		items[i].handle = FibHeapInsert(heap, &items[i]);
+	}
+
+	/* Building deep trees: one pop consolidates, then keys fall below parents */
+	FibHeapPop(heap);
+
+	for(i = 1; i < ORDER_ITEMS; ++i)
+	{
+		items[i].key = ORDER_ITEMS - i;
+		FibHeapDecreaseKey(heap, items[i].handle, &items[i]);
+		assert(&items[i] == FibHeapPeek(heap));
+	}
+
+	/* Removing the first element, an element in the middle and a leaf */
+	data = FibHeapRemove(heap, items[ORDER_ITEMS - 1].handle);
+	assert(&items[ORDER_ITEMS - 1] == data);
+	data = FibHeapRemove(heap, items[ORDER_ITEMS / 2].handle);
+	assert(&items[ORDER_ITEMS / 2] == data);
+	data = FibHeapRemove(heap, items[1].handle);
+	assert(&items[1] == data);
+	assert(ORDER_ITEMS - 4 == FibHeapSize(heap));
+
+	for(i = ORDER_ITEMS - 2; i > 1; --i)
+	{
+		if(ORDER_ITEMS / 2 != i)
+		{
+			data = FibHeapPop(heap);
+			assert(&items[i] == data);
+		}
+	}
+
+	assert(FibHeapIsEmpty(heap));
+	FibHeapDestroy(heap);
+	puts("\nDecreasing keys and removing passed successfully.");
+}
+/*****************************************************************************/
+void TestRandom(void)
+{
+	static item_t items[RANDOM_ITEMS];
+	fib_heap_t *heap = FibHeapCreate(CmpItems);
+	item_t *item = NULL;
+	void *data = NULL;
+	size_t live = 0;
+	size_t min = 0;
+	size_t step = 0;
+	size_t i = 0;
+
+	srand(7);
+
+	for(step = 0; step < RANDOM_STEPS; ++step)
+	{
+		item = &items[(size_t)rand() % RANDOM_ITEMS];
+
+		switch(rand() % 4)
+		{
+			case 0:
+				if(!item->is_live)
+				{
+					item->key = (size_t)rand() % 100000;
+					item->handle = FibHeapInsert(heap, item);
+					item->is_live = 1;
+					++live;
+				}
+				break;
+
+			case 1:
+				if(live)
+				{
+					item = (item_t *)FibHeapPop(heap);
+					assert(item->is_live);
+					item->is_live = 0;
+					--live;
+				}
+				break;
+
+			case 2:
+				if(item->is_live)
+				{
+					item->key -= item->key ? (size_t)rand() % item->key : 0;
+					FibHeapDecreaseKey(heap, item->handle, item);
+				}
+				break;
+
+			default:
+				if(item->is_live)
+				{
+					data = FibHeapRemove(heap, item->handle);
+					assert(item == data);
+					item->is_live = 0;
+					--live;
+				}
+				break;
+		}
+
+		assert(live == FibHeapSize(heap));
+
+		if(live && 0 == step % 64)
+		{
+			min = (size_t)-1;
+			for(i = 0; i < RANDOM_ITEMS; ++i)
+			{
+				if(items[i].is_live && items[i].key < min)
+				{
+					min = items[i].key;
+				}
+			}
+
+			assert(min == ((item_t *)FibHeapPeek(heap))->key);
+		}
+	}
+
+	FibHeapDestroy(heap);
+	puts("\nRandom operations passed successfully.");
+}
+/*****************************************************************************/
+int CmpItems(void *data, void *param)
+{
+	size_t key = ((item_t *)data)->key;
+	size_t other = ((item_t *)param)->key;
+
+	return ((key > other) - (key < other));
+}
+/*****************************************************************************/
@@ -0,0 +1,145 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This benchmark runs a million concurrent timers through the
+ *               timer wheel, and compares it on a smaller load with a single
+ *               list scanned with DLLFind on every tick.
+ *
+ *               Usage: timer_wheel_bench [number of timers]
+ * 
+******************************************************************************/
+#include <stdio.h>       /* printf               */
+#include <stdlib.h>      /* malloc, free, rand   */
+#include <time.h>        /* clock                */
+
+#include "dll.h"         /* Internal API         */
+#include "timer_wheel.h" /* Internal API         */
+/*****************************************************************************/
+#define DEFAULT_TIMERS (1000000UL)
+#define MAX_DELAY (100000UL)
+#define NAIVE_TIMERS (10000UL)
+#define NAIVE_MAX_DELAY (10000UL)
+#define SECONDS(start) ((double)(clock() - (start)) / CLOCKS_PER_SEC)
+/*****************************************************************************/
+void Expire(void *param);
+int IsExpired(void *data, void *param);
+void BenchWheel(size_t timers, size_t max_delay);
+void BenchNaive(size_t timers, size_t max_delay);
+/*****************************************************************************/
+int main(int argc, char *argv[])
+{
+	size_t timers = (1 < argc) ? strtoul(argv[1], NULL, 10) : DEFAULT_TIMERS;
+
+	printf("%-26s %10s %10s %10s %10s\n", "", "schedule", "cancel", "expire", "fired");
+	BenchWheel(timers, MAX_DELAY);
+	BenchWheel(NAIVE_TIMERS, NAIVE_MAX_DELAY);
+	BenchNaive(NAIVE_TIMERS, NAIVE_MAX_DELAY);
+
+	return 0;
+}
+/*****************************************************************************/
+void BenchWheel(size_t timers, size_t max_delay)
+{
+	char title[64];
+	size_t i = 0;
+	size_t fired = 0;
+	timer_wheel_t *wheel = TimerWheelCreate();
+	wheel_timer_t **handles = (wheel_timer_t **)malloc(timers * sizeof(wheel_timer_t *));
+	clock_t start = clock();
+	double schedule = 0;
+	double cancel = 0;
+
+	if(NULL == wheel || NULL == handles)
+	{
+		return;
+	}
+
+	srand(42);
+	for(i = 0; i < timers; ++i)
+	{
+		handles[i] = TimerWheelSchedule(wheel, 1 + (size_t)rand() % max_delay, Expire, &fired);
+	}
+
+	schedule = SECONDS(start);
+	start = clock();
+
+	for(i = 0; i < timers; i += 10)
+	{
+		TimerWheelCancel(wheel, handles[i]);
+	}
+
+	cancel = SECONDS(start);
+	start = clock();
+	TimerWheelAdvance(wheel, max_delay);
+
+	sprintf(title, "wheel, %lu timers", (unsigned long)timers);
+	printf("%-26s %10.3f %10.3f %10.3f %10lu\n", title, schedule, cancel, SECONDS(start),
+	       (unsigned long)fired);
+
+	free(handles);
+	TimerWheelDestroy(wheel);
+}
+/*****************************************************************************/
+void BenchNaive(size_t timers, size_t max_delay)
+{
+	char title[64];
+	size_t i = 0;
+	size_t now = 0;
+	size_t fired = 0;
+	dll_t *dll = DLLCreate();
+	clock_t start = clock();
+	double schedule = 0;
+	double cancel = 0;
+	dll_iter_t iter = NULL;
+
+	srand(42);
+	for(i = 0; i < timers; ++i)
+	{
+		DLLPushBack(dll, (void *)(1 + (size_t)rand() % max_delay));
+	}
+
+	schedule = SECONDS(start);
+	start = clock();
+
+	/* Without handles, cancelling is a search too */
+	srand(42);
+	for(i = 0; i < timers; ++i)
+	{
+		size_t expires = 1 + (size_t)rand() % max_delay;
+		if(0 == i % 10)
+		{
+			DLLRemove(DLLFind(DLLBegin(dll), DLLEnd(dll), IsExpired, (void *)expires));
+		}
+	}
+
+	cancel = SECONDS(start);
+	start = clock();
+
+	for(now = 1; now <= max_delay; ++now)
+	{
+		iter = DLLFind(DLLBegin(dll), DLLEnd(dll), IsExpired, (void *)now);
+		while(!DLLIterIsEqual(iter, DLLEnd(dll)))
+		{
+			Expire(&fired);
+			iter = DLLRemove(iter);
+			iter = DLLFind(iter, DLLEnd(dll), IsExpired, (void *)now);
+		}
+	}
+
+	sprintf(title, "DLLFind, %lu timers", (unsigned long)timers);
+	printf("%-26s %10.3f %10.3f %10.3f %10lu\n", title, schedule, cancel, SECONDS(start),
+	       (unsigned long)fired);
+
+	DLLDestroy(dll);
+}
+/*****************************************************************************/
+void Expire(void *param)
+{
+	++*(size_t *)param;
+}
+/*****************************************************************************/
+int IsExpired(void *data, void *param)
+{
+	return (data != param);
+}
+/*****************************************************************************/
@@ -0,0 +1,242 @@
+/******************************************************************************
+ * @date:        18.10.2026
+ *
+ * @description: This test file tests the hierarchical timer wheel: expiry at the
+ *               exact tick across every level, cancelling, and scheduling or
+ *               cancelling from within fired timers.
+ * 
+******************************************************************************/
+#include <stdio.h>         /* printf, puts  */
+#include <stdlib.h>        /* rand, srand   */
+#include <assert.h>        /* assert    :)  */
+
+#include "timer_wheel.h"   /* Internal API  */
+/*****************************************************************************/
+#define RANDOM_TIMERS (20000)
+
+typedef struct probe
+{
+	timer_wheel_t *wheel;
+	wheel_timer_t *timer;
+	size_t expected;
+	size_t fired_at;
+	size_t fired;
+	struct probe *other;
+
+} probe_t;
+/*****************************************************************************/
+void Record(void *param);
+void CancelOther(void *param);
+void Reschedule(void *param);
+void TestExactExpiry(void);
+void TestCancel(void);
+void TestFromCallback(void);
+void TestRandom(void);
+/*****************************************************************************/
+int main(void)
+{
+	TestExactExpiry();
+	TestCancel();
+	TestFromCallback();
+	TestRandom();
+
+	printf("\n\nDone!\n\n");
+	return 0;
+}
+/*****************************************************************************/
+void TestExactExpiry(void)
+{
+	size_t delays[] = {0, 1, 2, 63, 64, 65, 127, 4095, 4096, 4097, 262143, 262144, 300000};
+	size_t count = sizeof(delays) / sizeof(delays[0]);
+	probe_t probes[sizeof(delays) / sizeof(delays[0])];
+	timer_wheel_t *wheel = TimerWheelCreate();
+	size_t expired = 0;
+	size_t i = 0;
+
+	assert(wheel);
+	assert(0 == TimerWheelNow(wheel));
+
+	/* Starting off a level boundary */
+	TimerWheelAdvance(wheel, 10);
+
+	for(i = 0; i < count; ++i)
+	{
+		probes[i].wheel = wheel;
+		probes[i].expected = 10 + (delays[i] ? delays[i] : 1);
+		probes[i].fired = 0;
+		probes[i].timer = TimerWheelSchedule(wheel, delays[i], Record, &probes[i]);
+		assert(probes[i].timer);
+	}
+
+	assert(count == TimerWheelCount(wheel));
+	expired = TimerWheelAdvance(wheel, 300000);
+	assert(count == expired);
+	assert(0 == TimerWheelCount(wheel));
+	assert(300010 == TimerWheelNow(wheel));
+
+	for(i = 0; i < count; ++i)
+	{
+		assert(1 == probes[i].fired);
+		assert(probes[i].expected == probes[i].fired_at);
+	}
+
+	TimerWheelDestroy(wheel);
+	puts("\nExpiry at the exact tick passed successfully.");
+}
+/*****************************************************************************/
+void TestCancel(void)
+{
+	probe_t probes[10];
+	timer_wheel_t *wheel = TimerWheelCreate();
+	size_t expired = 0;
+	size_t i = 0;
+
+	for(i = 0; i < 10; ++i)
+	{
+		probes[i].wheel = wheel;
+		probes[i].expected = 5;
+		probes[i].fired = 0;
+		probes[i].timer = TimerWheelSchedule(wheel, 5, Record, &probes[i]);
+	}
+
+	/* Cancelling every other timer of the same slot */
+	for(i = 0; i < 10; i += 2)
+	{
+		TimerWheelCancel(wheel, probes[i].timer);
+	}
+
+	assert(5 == TimerWheelCount(wheel));
+	expired = TimerWheelAdvance(wheel, 100);
+	assert(5 == expired);
+
+	for(i = 0; i < 10; ++i)
+	{
+		assert((i % 2) == probes[i].fired);
+	}
+
+	/* Pending timers are dropped on destroy */
+	TimerWheelSchedule(wheel, 1000, Record, &probes[0]);
+	TimerWheelDestroy(wheel);
+	puts("\nCancelling timers passed successfully.");
+}
+/*****************************************************************************/
+void TestFromCallback(void)
+{
+	probe_t first;
+	probe_t second;
+	probe_t again;
+	timer_wheel_t *wheel = TimerWheelCreate();
+	size_t expired = 0;
+
+	first.wheel = wheel;
+	first.fired = 0;
+	first.other = &second;
+	second.wheel = wheel;
+	second.fired = 0;
+	second.expected = 0;
+
+	first.timer = TimerWheelSchedule(wheel, 3, CancelOther, &first);
+	second.timer = TimerWheelSchedule(wheel, 3, Record, &second);
+
+	again.wheel = wheel;
+	again.fired = 0;
+	again.expected = 7;
+	again.timer = TimerWheelSchedule(wheel, 2, Reschedule, &again);
+
+	expired = TimerWheelAdvance(wheel, 3);
+	assert(2 == expired);
+	assert(1 == first.fired);
+	assert(0 == second.fired);
+	assert(1 == TimerWheelCount(wheel));
+
+	expired = TimerWheelAdvance(wheel, 10);
+	assert(1 == expired);
+	assert(2 == again.fired);
+	assert(7 == again.fired_at);
+
+	TimerWheelDestroy(wheel);
+	puts("\nScheduling and cancelling from callbacks passed successfully.");
+}
+/*****************************************************************************/
+void TestRandom(void)
+{
+	static probe_t probes[RANDOM_TIMERS];
+	timer_wheel_t *wheel = TimerWheelCreate();
+	size_t cancelled = 0;
+	size_t fired = 0;
+	size_t delay = 0;
+	size_t i = 0;
+
+	srand(42);
+
+	for(i = 0; i < RANDOM_TIMERS; ++i)
+	{
+		delay = ((size_t)rand() * (size_t)rand()) % 2000000;
+		probes[i].wheel = wheel;
+		probes[i].expected = TimerWheelNow(wheel) + (delay ? delay : 1);
+		probes[i].fired = 0;
+		probes[i].timer = TimerWheelSchedule(wheel, delay, Record, &probes[i]);
+
+		if(0 == i % 100)
+		{
+			fired += TimerWheelAdvance(wheel, (size_t)rand() % 1000);
+		}
+	}
+
+	for(i = 0; i < RANDOM_TIMERS; i += 7)
+	{
+		if(0 == probes[i].fired)
+		{
+			TimerWheelCancel(wheel, probes[i].timer);
+			probes[i].expected = 0;
+			++cancelled;
+		}
+	}
+
+	while(TimerWheelCount(wheel))
+	{
+		fired += TimerWheelAdvance(wheel, 4096);
+	}
+
+	assert(RANDOM_TIMERS == fired + cancelled);
+
+	for(i = 0; i < RANDOM_TIMERS; ++i)
+	{
+		assert((0 != probes[i].expected) == probes[i].fired);
+		assert(!probes[i].fired || probes[i].expected == probes[i].fired_at);
+	}
+
+	TimerWheelDestroy(wheel);
+	puts("\nRandom timers passed successfully.");
+}
+/*****************************************************************************/
+void Record(void *param)
+{
+	probe_t *probe = (probe_t *)param;
+
+	++probe->fired;
+	probe->fired_at = TimerWheelNow(probe->wheel);
+}
+/*****************************************************************************/
+void CancelOther(void *param)
+{
+	probe_t *probe = (probe_t *)param;
+
+	Record(param);
+	TimerWheelCancel(probe->wheel, probe->other->timer);
+
+	/* Cancelling the timer being fired has no effect */
+	TimerWheelCancel(probe->wheel, probe->timer);
+}
+/*****************************************************************************/
+void Reschedule(void *param)
+{
+	probe_t *probe = (probe_t *)param;
+
+	Record(param);
+	if(1 == probe->fired)
+	{
+		probe->timer = TimerWheelSchedule(probe->wheel, 5, Reschedule, param);
+	}
+}
+/*****************************************************************************/